@@ -111,3 +111,34 @@ void CallRateProfiler::logStats() {
                  _name, _callRate, (float)callsSinceLastLog, _intervalMs, _callCount);
   }
 }
+
+// ============================================================================
+// WriteFilterProfiler Implementation
+// ============================================================================
+
+WriteFilterProfiler::WriteFilterProfiler(const char* name, bool enabled, uint32_t intervalMs)
+  : BaseProfiler(enabled, intervalMs),
+    _name(name),
+    _issuedWrites(0),
+    _suppressedWrites(0) {
+}
+
+uint32_t WriteFilterProfiler::getIssuedWrites() const {
+  return _issuedWrites;
+}
+
+uint32_t WriteFilterProfiler::getSuppressedWrites() const {
+  return _suppressedWrites;
+}
+
+void WriteFilterProfiler::reset() {
+  _issuedWrites = 0;
+  _suppressedWrites = 0;
+}
+
+void WriteFilterProfiler::logStats() {
+  uint32_t total = _issuedWrites + _suppressedWrites;
+  Log::println("%s: issued %d, suppressed %d (%.1f%% suppressed)",
+               _name, _issuedWrites, _suppressedWrites,
+               total > 0 ? (100.0f * _suppressedWrites / total) : 0.0f);
+}
@@ -181,4 +181,66 @@ class CallRateProfiler : public BaseProfiler {
     uint32_t _executedCalls;    // Successful executions (not rate limited)
 };
 
+/**
+ * WriteFilterProfiler - Issued vs suppressed write tracking
+ *
+ * Counts writes that were sent and writes that were skipped because the
+ * value had not (meaningfully) changed. Logs the suppression ratio at
+ * regular intervals.
+ *
+ * Usage:
+ *   WriteFilterProfiler profiler("ServoFrame", true, 1000);
+ *   profiler.recordIssued();      // Value changed and was written
+ *   profiler.recordSuppressed();  // Value unchanged, write skipped
+ *   profiler.update(millis());    // Call in loop()
+ */
+class WriteFilterProfiler : public BaseProfiler {
+  public:
+    /**
+     * Constructor
+     *
+     * @param name Name for this profiler (e.g., "ServoFrame")
+     * @param enabled Enable or disable profiling output (default: false)
+     * @param intervalMs Logging interval in milliseconds (default: 1000)
+     */
+    WriteFilterProfiler(const char* name, bool enabled = false, uint32_t intervalMs = 1000);
+
+    /**
+     * Record a write that was sent
+     */
+    void recordIssued() { _issuedWrites++; }
+
+    /**
+     * Record a write that was skipped
+     */
+    void recordSuppressed() { _suppressedWrites++; }
+
+    /**
+     * Get total number of writes sent since last reset
+     *
+     * @return Issued write count
+     */
+    uint32_t getIssuedWrites() const;
+
+    /**
+     * Get total number of writes skipped since last reset
+     *
+     * @return Suppressed write count
+     */
+    uint32_t getSuppressedWrites() const;
+
+    /**
+     * Clear both counters
+     */
+    void reset();
+
+  protected:
+    void logStats() override;
+
+  private:
+    const char* _name;
+    uint32_t _issuedWrites;      // Writes that reached the output
+    uint32_t _suppressedWrites;  // Writes skipped as unchanged
+};
+
 #endif
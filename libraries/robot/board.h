@@ -2,6 +2,9 @@
 #define BOARD_H
 
 #include <stdint.h>
+#include <servo_calibration.h>
+#include <joint_motion.h>
+#include <motion_profile.h>
 
 #define SERVOMIN 150
 #define SERVOMAX 545
@@ -11,31 +14,53 @@
  */
 class Board {
 
-  private:
-    // Per-servo calibration offsets in degrees
-    // Positive offset = servo rotates counter-clockwise
-    // Negative offset = servo rotates clockwise
-    static const int8_t SERVO_CALIBRATION_OFFSETS[12];
-
   public:
 
     int pwmSDA();
     int pwmSCL();
 
-    // Angle-based interface (0-180 degrees)
-    float servoMin();
-    float servoMax();
-    float servoRange();
-    float servoSpeed();  // Default constant speed
-    float servoSpeed(uint16_t durationMs, float distance);  // Calculate speed based on duration
-    float servoMiddle();
-    float servoSafeMin() const { return 2.0f; }
-    float servoSafeMax() const { return 178.0f; }
-
-    // Calibration and conversion
-    int8_t getServoCalibrationOffset(uint8_t servoNum) const;
-    uint16_t angleToPWM(uint8_t servoNum, float angle) const;
-    float pwmToAngle(uint8_t servoNum, uint16_t pwm) const;
+    // Servo refresh rate (PCA9685 PWM frequency set in Pca9685::begin)
+    uint16_t pwmFrequency() const { return 50; }
+
+    // Angle-based interface (0-180 degrees, fixed point - see joint_motion.h)
+    // constexpr so gait tables can be compiled against them (gait_compiler.h)
+    static constexpr AngleQ8 servoMiddle() { return JointMotion::degrees(90); }
+    static constexpr AngleQ8 servoSafeMin() { return JointMotion::degrees(2); }
+    static constexpr AngleQ8 servoSafeMax() { return JointMotion::degrees(178); }
+
+    // Default constant speed - full range (180 degrees) in 1s
+    static constexpr SpeedQ16 servoSpeed() { return JointMotion::degreesPerSecond(180); }
+
+    // Speed to cover distance in duration
+    static constexpr SpeedQ16 servoSpeed(uint16_t durationMs, AngleQ8 distance) {
+      // Duration = 0 means use constant speed
+      if (durationMs == 0) {
+        return servoSpeed();  // Default constant speed (180°/s)
+      }
+
+      // Calculate speed needed to cover distance in given duration
+      // Q8.8 degrees / ms -> Q16.16 degrees per ms is a shift by 8
+      SpeedQ16 calculatedSpeed = ((uint32_t)distance << 8) / durationMs;
+
+      // Physical limit: servos can do ~180° in 0.3s = 600°/s max
+      // Clamp to safe maximum
+      if (calculatedSpeed > JointMotion::degreesPerSecond(600)) {
+        return JointMotion::degreesPerSecond(600);
+      }
+
+      return calculatedSpeed;
+    }
+
+    // Acceleration and jerk limits for trapezoid and S-curve profiles
+    MotionLimits servoLimits() const { return { 3000, 100000 }; }
+
+    // Calibration used until a servo has been calibrated and saved to NVS
+    // (linear 0-180° over SERVOMIN-SERVOMAX)
+    ServoCalibration defaultCalibration() const;
+
+    // Safety limits applied to every calibrated PWM value
+    uint16_t pwmSafeMin() const { return SERVOMIN + 5; }
+    uint16_t pwmSafeMax() const { return SERVOMAX - 5; }
 };
 
 #endif
@@ -2,42 +2,27 @@
 #include <logging.h>
 #include <Arduino.h>
 
-Body::Body(Board& board)
+Body::Body(Board& board, II2cBus& bus)
   : _board(board),
-    // Initialize all 12 servos with their servo numbers (0-11)
-    _leftFrontShoulder(board, 0),
-    _leftFrontKnee(board, 1),
-    _leftMiddleShoulder(board, 2),
-    _leftMiddleKnee(board, 3),
-    _leftRearShoulder(board, 4),
-    _leftRearKnee(board, 5),
-    _rightFrontShoulder(board, 6),
-    _rightFrontKnee(board, 7),
-    _rightMiddleShoulder(board, 8),
-    _rightMiddleKnee(board, 9),
-    _rightRearShoulder(board, 10),
-    _rightRearKnee(board, 11),
-    // Initialize all 6 legs with their servos and initial positions (90 degrees)
-    _leftFront(_leftFrontShoulder, _leftFrontKnee, 90.0f, 90.0f),
-    _leftMiddle(_leftMiddleShoulder, _leftMiddleKnee, 90.0f, 90.0f),
-    _leftRear(_leftRearShoulder, _leftRearKnee, 90.0f, 90.0f),
-    _rightFront(_rightFrontShoulder, _rightFrontKnee, 90.0f, 90.0f),
-    _rightMiddle(_rightMiddleShoulder, _rightMiddleKnee, 90.0f, 90.0f),
-    _rightRear(_rightRearShoulder, _rightRearKnee, 90.0f, 90.0f) {
-
-  // Build servo array for iteration
-  _servos[0] = &_leftFrontShoulder;
-  _servos[1] = &_leftFrontKnee;
-  _servos[2] = &_leftMiddleShoulder;
-  _servos[3] = &_leftMiddleKnee;
-  _servos[4] = &_leftRearShoulder;
-  _servos[5] = &_leftRearKnee;
-  _servos[6] = &_rightFrontShoulder;
-  _servos[7] = &_rightFrontKnee;
-  _servos[8] = &_rightMiddleShoulder;
-  _servos[9] = &_rightMiddleKnee;
-  _servos[10] = &_rightRearShoulder;
-  _servos[11] = &_rightRearKnee;
+    _output(bus),
+    _frame(),
+    _jointStates(),
+    // Initialize all 6 legs with their initial positions (90 degrees)
+    _leftFront(board, _frame, _jointStates, board.servoMiddle()),
+    _leftMiddle(board, _frame, _jointStates, board.servoMiddle()),
+    _leftRear(board, _frame, _jointStates, board.servoMiddle()),
+    _rightFront(board, _frame, _jointStates, board.servoMiddle()),
+    _rightMiddle(board, _frame, _jointStates, board.servoMiddle()),
+    _rightRear(board, _frame, _jointStates, board.servoMiddle()),
+    _idleReleaseMs(0),
+    _profile(ProfileType::CONSTANT),
+    _limits(board.servoLimits()),
+    _synchronizedArrival(false),
+    _motionCompleteCallback(nullptr),
+    _motionPending(false),
+    _blendRadius(0),
+    _blendStep(false),
+    _kinematics() {
 
   // Build leg array for iteration
   _legs[0] = &_leftFront;
@@ -46,27 +31,71 @@ Body::Body(Board& board)
   _legs[3] = &_rightFront;
   _legs[4] = &_rightMiddle;
   _legs[5] = &_rightRear;
+
+  // Build servo array in topology order (servo index = leg * joints + joint)
+  // and hand every joint to the write scheduler
+  for (int leg = 0; leg < LEG_COUNT; leg++) {
+    for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+      _servos[Topology::servoIndex(leg, j)] = &_legs[leg]->servo(j);
+      _writeScheduler.add(_legs[leg]->joint(j));
+    }
+  }
 }
 
 void Body::begin() {
-  // Initialize PWM driver once for all servos
-  Servo::initializePWM(_board);
+  // Initialize PWM drivers once for all servos and start the output task
+  _output.begin();
+
+  // Build each servo's angle table from stored calibration (or defaults)
+  _calibration.setSafeRange(_board.pwmSafeMin(), _board.pwmSafeMax());
+  _calibration.setDefaults(_board.defaultCalibration());
+  _calibration.load();
+  for (int i = 0; i < SERVO_COUNT; i++) {
+    _servos[i]->calibrate(_calibration.get(i));
+  }
 
-  // Initialize all servos (set their initial positions)
+  // Initialize all servos (stage their initial positions) and send in one burst per board
   for (int i = 0; i < SERVO_COUNT; i++) {
     _servos[i]->begin();
   }
+  flush();
 
-  Log::println("Body: initialized %d legs with %d servos", LEG_COUNT, SERVO_COUNT);
+  Log::println("Body: initialized %d legs with %d servos on %d PWM driver(s)",
+               LEG_COUNT, SERVO_COUNT, Topology::DRIVER_COUNT);
 }
 
 void Body::update(uint32_t deltaMs) {
-  // Update all legs based on elapsed time
-  for (int i = 0; i < LEG_COUNT; i++) {
-    _legs[i]->update(deltaMs);
+  // Movement started outside applyGait() (e.g. resetToMiddle) re-arms here
+  engageLegs();
+
+  // Step every joint in one pass over the state arrays
+  _jointStates.update(deltaMs);
+
+  // Stage this tick's servo writes - final positions plus the joints
+  // furthest behind, up to the per-frame budget
+  _writeScheduler.schedule();
+
+  // Hand everything the legs staged this tick to the output task,
+  // which sends it as one I2C transaction
+  flush();
+
+  // Report arrival last, so the callback may apply the next step.
+  // Steps that move nothing are pending too and complete on this tick.
+  // A step with another after it is complete inside the blend radius
+  bool arrived = _jointStates.allAtTarget() ||
+                 (_blendStep && _jointStates.allWithin(_blendRadius));
+  if (_motionPending && arrived) {
+    _motionPending = false;
+    if (_motionCompleteCallback) {
+      _motionCompleteCallback();
+    }
   }
 }
 
+void Body::flush() {
+  _output.publish(_frame);
+}
+
 void Body::applyGait(GaitSequence& gait) {
   // Log gait and step info before applying (debug mode only)
   Log::debugln("Gait '%s'", gait.getName());
@@ -75,76 +104,225 @@ void Body::applyGait(GaitSequence& gait) {
     Log::debugln("  Step %d: '%s'", gait.getStepIndex(), stepName);
   }
 
-  // Apply sequence to each leg (stateless - can be reapplied)
+  // Compiled gaits copy their targets straight into the joint states.
+  // Otherwise apply sequence to each leg (stateless - can be reapplied)
   // Note: Must call type-specific methods for compile-time type safety
-  gait.applyTo(_leftFront);
-  gait.applyTo(_leftMiddle);
-  gait.applyTo(_leftRear);
-  gait.applyTo(_rightFront);
-  gait.applyTo(_rightMiddle);
-  gait.applyTo(_rightRear);
+  _jointStates.beginStep();
+  if (!gait.applyCompiled(_jointStates)) {
+    gait.applyTo(_leftFront);
+    gait.applyTo(_leftMiddle);
+    gait.applyTo(_leftRear);
+    gait.applyTo(_rightFront);
+    gait.applyTo(_rightMiddle);
+    gait.applyTo(_rightRear);
+  }
+  _motionPending = true;
+  _blendStep = _blendRadius > 0 && gait.hasNextStep();
+
+  // Stretch the faster moves so the whole step lands on one frame
+  if (_synchronizedArrival || gait.synchronizesArrival()) {
+    _jointStates.synchronizeArrival(_jointStates.getStepMask());
+  }
+
+  // Re-arm released legs and send them now so they are holding their
+  // last angle before the first motion tick
+  if (engageLegs() > 0) {
+    flush();
+  }
 }
 
-bool Body::atTarget() const {
+int Body::engageLegs() {
+  int engaged = 0;
   for (int i = 0; i < LEG_COUNT; i++) {
-    if (!_legs[i]->atTarget()) {
-      return false;
+    if (_legs[i]->isReleased()) {
+      engaged++;
     }
+    _legs[i]->engage();
   }
-  return true;
+  if (engaged > 0) {
+    Log::debugln("Body: re-armed %d idle legs", engaged);
+  }
+  return engaged;
+}
+
+void Body::setIdleRelease(uint32_t timeoutMs) {
+  _idleReleaseMs = timeoutMs;
+  if (timeoutMs == 0) {
+    // Disabled - hold every leg again
+    engageLegs();
+    flush();
+  }
+  Log::println("Body: idle release %s (%lu ms)", timeoutMs ? "on" : "off", (unsigned long)timeoutMs);
+}
+
+void Body::updateIdle(uint32_t deltaMs) {
+  int released = 0;
+  for (int i = 0; i < LEG_COUNT; i++) {
+    if (_legs[i]->updateIdle(deltaMs, _idleReleaseMs)) {
+      released++;
+    }
+  }
+  if (released > 0) {
+    flush();
+    Log::debugln("Body: released %d idle legs", released);
+  }
+}
+
+int Body::getReleasedLegCount() const {
+  int count = 0;
+  for (int i = 0; i < LEG_COUNT; i++) {
+    if (_legs[i]->isReleased()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+bool Body::atTarget() const {
+  return _jointStates.allAtTarget();
+}
+
+void Body::onMotionComplete(MotionCompleteCallback callback) {
+  _motionCompleteCallback = callback;
 }
 
 void Body::resetToMiddle() {
-  float middle = _board.servoMiddle();  // Returns 90.0f
-  float speed = _board.servoSpeed();    // Returns 180.0f degrees/sec
+  AngleQ8 middle = _board.servoMiddle();  // 90 degrees
+  SpeedQ16 speed = _board.servoSpeed();   // 180 degrees/sec
 
   // Set all legs to middle position
   for (int i = 0; i < LEG_COUNT; i++) {
-    _legs[i]->shoulder().setTarget(middle, speed);
-    _legs[i]->knee().setTarget(middle, speed);
+    for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+      _legs[i]->joint(j).setTarget(middle, speed);
+    }
   }
+  _motionPending = true;
+  _blendStep = false;
 
   Log::println("Body: reset to middle position (90°)");
 }
 
 void Body::logState() const {
   Log::println("Body State:");
-  Log::println("  LF: shoulder=%.1f knee=%.1f",
-               _leftFront.shoulder().getPosition(),
-               _leftFront.knee().getPosition());
-  Log::println("  LM: shoulder=%.1f knee=%.1f",
-               _leftMiddle.shoulder().getPosition(),
-               _leftMiddle.knee().getPosition());
-  Log::println("  LR: shoulder=%.1f knee=%.1f",
-               _leftRear.shoulder().getPosition(),
-               _leftRear.knee().getPosition());
-  Log::println("  RF: shoulder=%.1f knee=%.1f",
-               _rightFront.shoulder().getPosition(),
-               _rightFront.knee().getPosition());
-  Log::println("  RM: shoulder=%.1f knee=%.1f",
-               _rightMiddle.shoulder().getPosition(),
-               _rightMiddle.knee().getPosition());
-  Log::println("  RR: shoulder=%.1f knee=%.1f",
-               _rightRear.shoulder().getPosition(),
-               _rightRear.knee().getPosition());
+  for (int i = 0; i < LEG_COUNT; i++) {
+    const Leg& leg = *_legs[i];
+#if ROBOT_LEG_DOF == 3
+    Log::println("  %s: shoulder=%.1f knee=%.1f tibia=%.1f",
+                 Topology::LEG_NAMES[i],
+                 JointMotion::toDegrees(leg.shoulder().getPosition()),
+                 JointMotion::toDegrees(leg.knee().getPosition()),
+                 JointMotion::toDegrees(leg.tibia().getPosition()));
+#else
+    Log::println("  %s: shoulder=%.1f knee=%.1f",
+                 Topology::LEG_NAMES[i],
+                 JointMotion::toDegrees(leg.shoulder().getPosition()),
+                 JointMotion::toDegrees(leg.knee().getPosition()));
+#endif
+  }
+}
+
+void Body::setMotionProfile(ProfileType type, const MotionLimits& limits) {
+  _profile = type;
+  _limits = limits;
+  for (int i = 0; i < LEG_COUNT; i++) {
+    for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+      _legs[i]->joint(j).setProfile(type, limits);
+    }
+  }
+  Log::println("Body: %s motion profile (accel %lu°/s², jerk %lu°/s³)",
+               MotionProfile::name(type), (unsigned long)limits.accel, (unsigned long)limits.jerk);
+}
+
+bool Body::setFootTarget(uint8_t leg, const FootPosition& foot, uint32_t durationMs) {
+  LegAngles angles;
+  if (!_kinematics.solve(foot, angles)) {
+    return false;
+  }
+
+  // Right legs mirror the left: forward and down are the other way round
+  int32_t sign = leg >= LEG_COUNT / 2 ? -1 : 1;
+  int32_t shoulder = (int32_t)_board.servoMiddle() + sign * angles.shoulder;
+  int32_t knee = (int32_t)_board.servoMiddle() + sign * angles.knee;
+  if (shoulder < _board.servoSafeMin() || shoulder > _board.servoSafeMax() ||
+      knee < _board.servoSafeMin() || knee > _board.servoSafeMax()) {
+    return false;
+  }
+
+  _legs[leg]->shoulder().setTargetTimed((AngleQ8)shoulder, durationMs);
+  _legs[leg]->knee().setTargetTimed((AngleQ8)knee, durationMs);
+#if ROBOT_LEG_DOF == 3
+  _legs[leg]->tibia().setTargetTimed(_board.servoMiddle(), durationMs);
+#endif
+  _motionPending = true;
+  return true;
+}
+
+FootPosition Body::getFootPosition(uint8_t leg) const {
+  int32_t sign = leg >= LEG_COUNT / 2 ? -1 : 1;
+  LegAngles angles;
+  angles.shoulder = sign * ((int32_t)_legs[leg]->shoulder().getPosition() - _board.servoMiddle());
+  angles.knee = sign * ((int32_t)_legs[leg]->knee().getPosition() - _board.servoMiddle());
+  return _kinematics.forward(angles);
+}
+
+void Body::setBlendRadius(AngleQ8 radius) {
+  _blendRadius = radius;
+  _jointStates.setBlending(radius > 0);
+  Log::println("Body: Blend radius %.1f°", JointMotion::toDegrees(radius));
+}
+
+void Body::setServoHysteresis(uint8_t ticks) {
+  for (int i = 0; i < SERVO_COUNT; i++) {
+    _servos[i]->setHysteresis(ticks);
+  }
+  Log::println("Body: servo hysteresis set to %d ticks", ticks);
+}
+
+Servo* Body::findServo(const String& servoName) {
+  // Servo names are the lowercase leg name followed by the joint name,
+  // e.g. "leftfrontshoulder", "rightrearknee" (or "...tibia" on 3-DOF)
+  for (int i = 0; i < LEG_COUNT; i++) {
+    String legName = _legs[i]->getName();
+    legName.toLowerCase();
+    if (!servoName.startsWith(legName)) {
+      continue;
+    }
+    for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+      if (servoName == legName + Topology::JOINT_NAMES[j]) {
+        return &_legs[i]->servo(j);
+      }
+    }
+  }
+  return nullptr;
+}
+
+bool Body::getServoCalibration(const String& servoName, ServoCalibration& cal) {
+  Servo* servo = findServo(servoName);
+  if (servo == nullptr) {
+    return false;
+  }
+  cal = _calibration.get(servo->getServoNum());
+  return true;
+}
+
+bool Body::setServoCalibration(const String& servoName, const ServoCalibration& cal) {
+  Servo* servo = findServo(servoName);
+  if (servo == nullptr || !_calibration.set(servo->getServoNum(), cal)) {
+    return false;
+  }
+
+  // Apply now (re-sends current position) and persist for next boot
+  servo->calibrate(cal);
+  flush();
+  _calibration.save();
+
+  Log::println("Body: calibrated '%s' min=%d mid=%d max=%d",
+               servoName.c_str(), cal.minPulse, cal.midPulse, cal.maxPulse);
+  return true;
 }
 
 bool Body::wiggleServo(const String& servoName) {
-  // Map servo name to servo pointer
-  Servo* servo = nullptr;
-
-  if (servoName == "leftfrontshoulder") servo = &_leftFrontShoulder;
-  else if (servoName == "leftfrontknee") servo = &_leftFrontKnee;
-  else if (servoName == "leftmiddleshoulder") servo = &_leftMiddleShoulder;
-  else if (servoName == "leftmiddleknee") servo = &_leftMiddleKnee;
-  else if (servoName == "leftrearshoulder") servo = &_leftRearShoulder;
-  else if (servoName == "leftrearknee") servo = &_leftRearKnee;
-  else if (servoName == "rightfrontshoulder") servo = &_rightFrontShoulder;
-  else if (servoName == "rightfrontknee") servo = &_rightFrontKnee;
-  else if (servoName == "rightmiddleshoulder") servo = &_rightMiddleShoulder;
-  else if (servoName == "rightmiddleknee") servo = &_rightMiddleKnee;
-  else if (servoName == "rightrearshoulder") servo = &_rightRearShoulder;
-  else if (servoName == "rightrearknee") servo = &_rightRearKnee;
+  Servo* servo = findServo(servoName);
 
   if (servo == nullptr) {
     Log::println("Body: Unknown servo name '%s'", servoName.c_str());
@@ -155,18 +333,22 @@ bool Body::wiggleServo(const String& servoName) {
 
   // Wiggle sequence: reset, +10%, -20%, reset
   // 10% of 180° = 18°, 20% = 36°
-  const float middle = 90.0f;
-  const float plusTenPercent = middle + 18.0f;   // 108°
-  const float minusTenPercent = middle - 18.0f;  // 72°
+  const AngleQ8 middle = _board.servoMiddle();
+  const AngleQ8 plusTenPercent = middle + JointMotion::degrees(18);   // 108°
+  const AngleQ8 minusTenPercent = middle - JointMotion::degrees(18);  // 72°
   const int delayMs = 300;
 
   servo->move(middle);           // Reset to middle
+  flush();
   delay(delayMs);
   servo->move(plusTenPercent);   // +10% (clockwise)
+  flush();
   delay(delayMs);
   servo->move(minusTenPercent);  // -20% from middle (counter-clockwise)
+  flush();
   delay(delayMs);
   servo->move(middle);           // Reset to middle
+  flush();
   delay(delayMs);
 
   Log::println("Body: Wiggle complete for '%s'", servoName.c_str());
@@ -10,13 +10,22 @@
 #include <right_rear_leg.h>
 #include <gait_sequence.h>
 #include <i_gait_target.h>
+#include <i_i2c_bus.h>
+#include <servo_frame.h>
+#include <servo_output_task.h>
+#include <servo_calibration.h>
+#include <servo_write_scheduler.h>
+#include <joint_states.h>
+#include <leg_kinematics.h>
 
 /*
  * Composes all the parts of the body - 6 named legs.
  *
- * Body owns all servos and legs. It coordinates movement by
+ * Body owns all legs, which own their servos. It coordinates movement by
  * applying gait sequences to the legs and updating them based
- * on elapsed time.
+ * on elapsed time. Servo output for each tick is collected in a
+ * ServoFrame and handed to the ServoOutputTask, which owns the PCA9685
+ * boards and sends one I2C burst per board without blocking the loop.
  *
  * Implements IGaitTarget for use with gait sequencing and testing.
  */
@@ -24,21 +33,15 @@ class Body : public IGaitTarget {
   private:
     Board& _board;
 
-    // All 12 servos (2 per leg)
-    Servo _leftFrontShoulder;
-    Servo _leftFrontKnee;
-    Servo _leftMiddleShoulder;
-    Servo _leftMiddleKnee;
-    Servo _leftRearShoulder;
-    Servo _leftRearKnee;
-    Servo _rightFrontShoulder;
-    Servo _rightFrontKnee;
-    Servo _rightMiddleShoulder;
-    Servo _rightMiddleKnee;
-    Servo _rightRearShoulder;
-    Servo _rightRearKnee;
-
-    // All 6 legs
+    // PWM output - declared before servos, which stage values into the frame
+    ServoOutputTask _output;
+    ServoFrame _frame;
+
+    // Motion state for all joints in contiguous arrays - legs and joints
+    // are views onto it, and update() steps it in one loop
+    JointStates _jointStates;
+
+    // All 6 legs - each owns its servos and joints (see robot_topology.h)
     LeftFrontLeg _leftFront;
     LeftMiddleLeg _leftMiddle;
     LeftRearLeg _leftRear;
@@ -47,13 +50,52 @@ class Body : public IGaitTarget {
     RightRearLeg _rightRear;
 
     // Arrays for iteration (initialized in constructor)
-    static const int SERVO_COUNT = 12;
-    static const int LEG_COUNT = 6;
+    static const int SERVO_COUNT = Topology::SERVO_COUNT;
+    static const int LEG_COUNT = Topology::LEG_COUNT;
     Servo* _servos[SERVO_COUNT];
     Leg* _legs[LEG_COUNT];
 
+    // Chooses which joints are written each tick within the bus budget
+    ServoWriteScheduler _writeScheduler;
+
+    // Per-servo calibration, persisted in NVS
+    ServoCalibrationStore _calibration;
+
+    // Idle time before a leg at target is switched to full-off (0 = never)
+    uint32_t _idleReleaseMs;
+
+    // Velocity profile applied to every joint
+    ProfileType _profile;
+    MotionLimits _limits;
+
+    // Time every gait step to arrive together, not just those that ask
+    bool _synchronizedArrival;
+
+    // Fired by update() when the targets set since the last call are reached
+    MotionCompleteCallback _motionCompleteCallback;
+    bool _motionPending;
+
+    // Report a step complete once every joint is this close to its target,
+    // so the next step blends in (0 = wait for exact arrival)
+    AngleQ8 _blendRadius;
+    bool _blendStep;
+
+    // Foot positions <-> shoulder/knee angles
+    LegKinematics _kinematics;
+
+    // Publish any staged servo values to the output task
+    void flush();
+
+    // Re-energize released legs at their last angle and restart idle timers
+    // (any gait step may lean on a leg that is not itself moving)
+    // Returns the number of legs re-armed
+    int engageLegs();
+
+    // Map servo name (leg + joint, e.g. "leftfrontknee") to servo, nullptr if unknown
+    Servo* findServo(const String& servoName);
+
   public:
-    Body(Board& board);
+    Body(Board& board, II2cBus& bus);
 
     void begin();
 
@@ -61,6 +103,7 @@ class Body : public IGaitTarget {
     void update(uint32_t deltaMs) override;
     void applyGait(GaitSequence& gait) override;
     bool atTarget() const override;
+    void onMotionComplete(MotionCompleteCallback callback) override;
     void resetToMiddle() override;
     void logState() const override;
 
@@ -72,6 +115,55 @@ class Body : public IGaitTarget {
     RightMiddleLeg& rightMiddle() { return _rightMiddle; }
     RightRearLeg& rightRear() { return _rightRear; }
 
+    // Leg by topology index (0-5, LF..RR)
+    Leg& leg(uint8_t index) { return *_legs[index]; }
+
+    // Idle power saving - while stationary, legs that stay at target for
+    // timeoutMs stop holding position; they re-arm before their next move
+    void setIdleRelease(uint32_t timeoutMs);
+    uint32_t getIdleRelease() const { return _idleReleaseMs; }
+    void updateIdle(uint32_t deltaMs);
+    int getReleasedLegCount() const;
+
+    // Velocity profile for all joints - takes effect from the next target
+    void setMotionProfile(ProfileType type, const MotionLimits& limits);
+    ProfileType getMotionProfile() const { return _profile; }
+    const MotionLimits& getMotionLimits() const { return _limits; }
+
+    // Synchronized arrival for every gait step, on top of the steps that set it
+    void setSynchronizedArrival(bool enabled) { _synchronizedArrival = enabled; }
+    bool getSynchronizedArrival() const { return _synchronizedArrival; }
+
+    // Blend radius between gait steps - the next step starts once every
+    // joint is within radius of its target, and joins the unfinished move
+    void setBlendRadius(AngleQ8 radius);
+    AngleQ8 getBlendRadius() const { return _blendRadius; }
+
+    // Foot-space control - a leg's foot position in mm in its own frame
+    // (leg_kinematics.h; right legs mirrored). setFootTarget() moves the
+    // shoulder and knee there in durationMs, and returns false without
+    // moving if the foot is out of reach or past the safe range. On 3-DOF
+    // legs the tibia is held at middle, so the knee-to-foot segment is
+    // the rigid femur the kinematics model (measure it that way)
+    bool setFootTarget(uint8_t leg, const FootPosition& foot, uint32_t durationMs) override;
+    FootPosition getFootPosition(uint8_t leg) const override;
+    LegKinematics& getKinematics() { return _kinematics; }
+
+    // Servo write suppression
+    void setServoHysteresis(uint8_t ticks);
+    uint8_t getServoHysteresis() const { return _servos[0]->getHysteresis(); }
+    WriteFilterProfiler& getServoWriteProfiler() { return _frame.getWriteProfiler(); }
+
+    // Per-frame servo write budget and statistics
+    ServoWriteScheduler& getWriteScheduler() { return _writeScheduler; }
+
+    // Output task statistics (frames published, sent, merged)
+    ServoOutputTask& getServoOutput() { return _output; }
+
+    // Calibration by servo name - set() applies immediately and saves to NVS
+    bool getServoCalibration(const String& servoName, ServoCalibration& cal);
+    bool setServoCalibration(const String& servoName, const ServoCalibration& cal);
+
     // Diagnostic: wiggle a servo by name to test connectivity
     // Returns true if servo name was valid, false otherwise
     bool wiggleServo(const String& servoName);
@@ -0,0 +1,85 @@
+#include <bus_benchmark.h>
+#include <logging.h>
+#include <Arduino.h>
+
+const uint32_t BusBenchmark::RATES[BusBenchmark::RATE_COUNT] = { 100000, 400000, 1000000 };
+
+// Power-on value of SUBADR1 (datasheet table 4)
+static const uint8_t SUBADR1_DEFAULT = 0xE2;
+
+BusBenchmark::BusBenchmark(II2cBus& bus)
+  : _bus(bus), _selectedHz(RATES[0]) {
+  for (uint8_t i = 0; i < RATE_COUNT; i++) {
+    _results[i] = { RATES[i], 0, 0, false };
+  }
+}
+
+BusRateResult BusBenchmark::measure(uint32_t clockHz, uint8_t roundTrips) {
+  BusRateResult result = { clockHz, 0, 0, true };
+  _bus.setClock(clockHz);
+
+  // A board further along the bus may fail where the first one passes
+  uint32_t totalUs = 0;
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    uint8_t address = Topology::DRIVER_ADDRESSES[d];
+    for (uint8_t i = 0; i < roundTrips; i++) {
+      // Single register, so it works before auto-increment is enabled.
+      // Varying pattern so a stuck bus can't pass; bit 0 is reserved.
+      uint8_t data[2] = { Pca9685::REG_SUBADR1, (uint8_t)((i * 37 + 0x5A) & 0xFE) };
+      uint8_t readBack = 0;
+
+      uint32_t start = micros();
+      bool ok = _bus.write(address, data, sizeof(data)) &&
+                _bus.read(address, Pca9685::REG_SUBADR1, &readBack, 1);
+      totalUs += micros() - start;
+
+      if (!ok || readBack != data[1]) {
+        result.errors++;
+      }
+    }
+  }
+
+  uint32_t total = (uint32_t)roundTrips * Topology::DRIVER_COUNT;
+  result.roundTripUs = total > 0 ? totalUs / total : 0;
+  return result;
+}
+
+uint32_t BusBenchmark::run(uint8_t roundTrips) {
+  _selectedHz = RATES[0];
+
+  for (uint8_t i = 0; i < RATE_COUNT; i++) {
+    _results[i] = { RATES[i], 0, 0, false };
+  }
+
+  for (uint8_t i = 0; i < RATE_COUNT; i++) {
+    _results[i] = measure(RATES[i], roundTrips);
+    if (!_results[i].reliable()) {
+      break;
+    }
+    _selectedHz = RATES[i];
+  }
+
+  // Restore the scratch register at a safe rate, then run at the selected rate
+  _bus.setClock(RATES[0]);
+  uint8_t restore[2] = { Pca9685::REG_SUBADR1, SUBADR1_DEFAULT };
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    _bus.write(Topology::DRIVER_ADDRESSES[d], restore, sizeof(restore));
+  }
+  _bus.setClock(_selectedHz);
+
+  return _selectedHz;
+}
+
+void BusBenchmark::logResults() const {
+  for (uint8_t i = 0; i < RATE_COUNT; i++) {
+    const BusRateResult& r = _results[i];
+    if (!r.measured) {
+      Log::println("BusBench: %4d kHz skipped", r.clockHz / 1000);
+      continue;
+    }
+    Log::println("BusBench: %4d kHz %s round trip %d us (%d us/transaction, %d errors)",
+                 r.clockHz / 1000, r.reliable() ? "ok  " : "FAIL",
+                 r.roundTripUs, r.transactionUs(), r.errors);
+  }
+  Log::println("BusBench: selected %d kHz", _selectedHz / 1000);
+}
@@ -0,0 +1,61 @@
+#ifndef BUS_BENCHMARK_H
+#define BUS_BENCHMARK_H
+
+#include <stdint.h>
+#include <i_i2c_bus.h>
+#include <pca9685.h>
+#include <robot_topology.h>
+
+/*
+ * Result of benchmarking the bus at one clock rate.
+ */
+struct BusRateResult {
+  uint32_t clockHz;
+  uint16_t errors;          // Failed or mismatched round trips, over all boards
+  uint32_t roundTripUs;     // Average write + read-back time (2 transactions)
+  bool measured;            // False if a slower rate already failed
+  bool reliable() const { return measured && errors == 0; }
+  uint32_t transactionUs() const { return roundTripUs / 2; }
+};
+
+/*
+ * Measures register round trips to every PCA9685 in the topology at each
+ * supported I2C clock rate, slowest first, and leaves the bus running at
+ * the fastest rate at which every board read back every value correctly
+ * (falling back to 100 kHz if none did). Faster
+ * rates are not tried once one fails - a bus that is marginal at 400 kHz
+ * is not trusted at 1 MHz because a short run happened to pass.
+ *
+ * Round trips write and read back the SUBADR1 register, which only
+ * matters when the sub-address bit in MODE1 is enabled (it is not); its
+ * power-on value is restored afterwards.
+ *
+ * The caller must have exclusive use of the bus while run() executes.
+ */
+class BusBenchmark {
+  public:
+    static const uint8_t RATE_COUNT = 3;
+    static const uint32_t RATES[RATE_COUNT];  // 100 kHz, 400 kHz, 1 MHz
+
+  private:
+    II2cBus& _bus;
+    BusRateResult _results[RATE_COUNT];
+    uint32_t _selectedHz;
+
+    BusRateResult measure(uint32_t clockHz, uint8_t roundTrips);
+
+  public:
+    BusBenchmark(II2cBus& bus);
+
+    // Benchmark each rate up to the first that fails, then select the
+    // fastest one below it. Returns the selected clock rate in Hz
+    uint32_t run(uint8_t roundTrips = 20);
+
+    const BusRateResult& getResult(uint8_t index) const { return _results[index]; }
+    uint32_t getSelectedClock() const { return _selectedHz; }
+
+    // Log one line per rate plus the selection
+    void logResults() const;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include <control_frame_clock.h>
+
+ControlFrameClock::ControlFrameClock(uint16_t refreshHz, uint8_t periodsPerFrame)
+  : _refreshUs(1000000UL / refreshHz),
+    _periodsPerFrame(periodsPerFrame > 0 ? periodsPerFrame : 1),
+    _frameUs(_refreshUs * _periodsPerFrame),
+    _frameStartUs(0),
+    _nextUs(0),
+    _missed(0),
+    _started(false),
+    _frames(0),
+    _overruns(0),
+    _skipped(0) {
+}
+
+void ControlFrameClock::start(uint32_t nowUs) {
+  _frameStartUs = nowUs;
+  _nextUs = nowUs;
+  _missed = 0;
+  _started = true;
+}
+
+bool ControlFrameClock::poll(uint32_t nowUs) {
+  if (!_started) {
+    start(nowUs);
+  }
+
+  // Signed difference handles micros() wrapping every ~71 minutes
+  int32_t late = (int32_t)(nowUs - _nextUs);
+  if (late < 0) {
+    return false;  // Not due yet
+  }
+
+  // A whole frame late - skip the missed frames but stay on the grid
+  _missed = 0;
+  if ((uint32_t)late >= _frameUs) {
+    _missed = (uint32_t)late / _frameUs;
+    _overruns++;
+    _skipped += _missed;
+    _nextUs += _missed * _frameUs;
+  }
+
+  _frameStartUs = _nextUs;
+  _nextUs += _frameUs;
+  _frames++;
+  return true;
+}
+
+void ControlFrameClock::setPeriodsPerFrame(uint8_t periods) {
+  _periodsPerFrame = periods > 0 ? periods : 1;
+  _frameUs = _refreshUs * _periodsPerFrame;
+  _nextUs = _frameStartUs + _frameUs;
+  _missed = 0;
+}
+
+void ControlFrameClock::resetStats() {
+  _frames = 0;
+  _overruns = 0;
+  _skipped = 0;
+}
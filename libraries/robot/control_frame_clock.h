@@ -0,0 +1,61 @@
+#ifndef CONTROL_FRAME_CLOCK_H
+#define CONTROL_FRAME_CLOCK_H
+
+#include <stdint.h>
+
+/*
+ * Fixed-rate control frames locked to the servo PWM refresh.
+ *
+ * The loop polls the clock with micros(); poll() returns true once per
+ * frame. Frames sit on a fixed grid of whole PWM periods (20 ms at 50 Hz),
+ * so all joint math runs with one timestamp and a constant step, and each
+ * frame's output lands once per servo refresh instead of at arbitrary
+ * points in it. A frame that starts a full frame late is an overrun: the
+ * missed frames are counted and skipped (not replayed in a burst) and the
+ * clock stays on the original grid. getElapsedMs() still covers them, so
+ * motion keeps to wall-clock time across an overrun.
+ */
+class ControlFrameClock {
+  private:
+    uint32_t _refreshUs;        // One PWM period
+    uint8_t _periodsPerFrame;   // Frame rate = refresh rate / this
+    uint32_t _frameUs;
+    uint32_t _frameStartUs;     // Timestamp of the current frame
+    uint32_t _nextUs;           // Start of the next frame
+    uint32_t _missed;           // Frames skipped just before the current one
+    bool _started;
+
+    // Statistics since last reset
+    uint32_t _frames;
+    uint32_t _overruns;
+    uint32_t _skipped;
+
+  public:
+    ControlFrameClock(uint16_t refreshHz = 50, uint8_t periodsPerFrame = 1);
+
+    // Put the first frame at nowUs
+    void start(uint32_t nowUs);
+
+    // True when a frame is due; the frame's timestamp is getFrameStartUs()
+    bool poll(uint32_t nowUs);
+
+    // Frame rate as a whole number of PWM periods per frame (1 = every refresh)
+    void setPeriodsPerFrame(uint8_t periods);
+    uint8_t getPeriodsPerFrame() const { return _periodsPerFrame; }
+    float getRateHz() const { return 1000000.0f / _frameUs; }
+
+    // Constant time step for joint updates
+    uint32_t getFrameMs() const { return _frameUs / 1000; }
+    uint32_t getFrameStartUs() const { return _frameStartUs; }
+
+    // Time since the previous frame - one step, plus any frames skipped
+    uint32_t getElapsedMs() const { return (1 + _missed) * _frameUs / 1000; }
+
+    // Statistics
+    uint32_t getFrameCount() const { return _frames; }
+    uint32_t getOverrunCount() const { return _overruns; }
+    uint32_t getSkippedFrameCount() const { return _skipped; }
+    void resetStats();
+};
+
+#endif
@@ -0,0 +1,138 @@
+#include "gait_arena.h"
+#include <logging.h>
+#include <string.h>
+
+// Value of a hex digit, -1 if it is not one
+static int8_t hexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+GaitArena::GaitArena()
+  : _uploadSize(0),
+    _uploadReceived(0) {
+  for (uint8_t i = 0; i < SLOTS; i++) {
+    _slots[i].used = false;
+    _slots[i].name[0] = '\0';
+    _slots[i].data = { _slots[i].name, _slots[i].steps, 0, false, nullptr };
+  }
+}
+
+GaitFormat::Error GaitArena::load(const uint8_t* blob, size_t size, uint8_t* slot) {
+  GaitFormat::Error error = GaitFormat::validate(blob, size);
+  if (error != GaitFormat::Error::NONE) {
+    Log::println("GaitArena: rejected gait - %s", GaitFormat::errorName(error));
+    return error;
+  }
+
+  // Same name replaces, otherwise the first free slot
+  const char* name = GaitFormat::name(blob);
+  int8_t index = -1;
+  for (uint8_t i = 0; i < SLOTS && index < 0; i++) {
+    if (_slots[i].used && strcmp(_slots[i].name, name) == 0) index = i;
+  }
+  for (uint8_t i = 0; i < SLOTS && index < 0; i++) {
+    if (!_slots[i].used) index = i;
+  }
+  if (index < 0) {
+    Log::println("GaitArena: no free slot for '%s'", name);
+    return GaitFormat::Error::NO_FREE_SLOT;
+  }
+
+  // Names are copied - the blob may be the upload buffer
+  Slot& target = _slots[index];
+  strncpy(target.name, name, GaitFormat::NAME_SIZE);
+  GaitFormat::decode(blob, target.steps, target.startPose, target.data);
+  uint8_t steps = target.data.stepCount;
+  for (uint8_t s = 0; s < steps; s++) {
+    target.steps[s].name = target.name;
+  }
+  target.data.name = target.name;
+  target.used = true;
+
+  if (slot != nullptr) {
+    *slot = (uint8_t)index;
+  }
+  Log::println("GaitArena: loaded '%s' (%d steps) into slot %d", target.name, steps, index);
+  return GaitFormat::Error::NONE;
+}
+
+const GaitSequenceData* GaitArena::find(const char* name) const {
+  for (uint8_t i = 0; i < SLOTS; i++) {
+    if (_slots[i].used && strcmp(_slots[i].name, name) == 0) {
+      return &_slots[i].data;
+    }
+  }
+  return nullptr;
+}
+
+const GaitSequenceData* GaitArena::get(uint8_t slot) const {
+  return slot < SLOTS && _slots[slot].used ? &_slots[slot].data : nullptr;
+}
+
+uint8_t GaitArena::getCount() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < SLOTS; i++) {
+    count += _slots[i].used ? 1 : 0;
+  }
+  return count;
+}
+
+bool GaitArena::remove(const char* name) {
+  for (uint8_t i = 0; i < SLOTS; i++) {
+    if (_slots[i].used && strcmp(_slots[i].name, name) == 0) {
+      _slots[i].used = false;
+      _slots[i].data.stepCount = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool GaitArena::beginUpload(size_t size) {
+  _uploadReceived = 0;
+  _uploadSize = size <= GaitFormat::MAX_BLOB_SIZE ? size : 0;
+  return _uploadSize > 0;
+}
+
+bool GaitArena::appendHex(const char* hex) {
+  size_t length = strlen(hex);
+  if (_uploadSize == 0 || length % 2 != 0 || _uploadReceived + length / 2 > _uploadSize) {
+    _uploadSize = 0;
+    return false;
+  }
+  for (size_t i = 0; i < length; i += 2) {
+    int8_t high = hexDigit(hex[i]);
+    int8_t low = hexDigit(hex[i + 1]);
+    if (high < 0 || low < 0) {
+      _uploadSize = 0;
+      return false;
+    }
+    _upload[_uploadReceived++] = (uint8_t)((high << 4) | low);
+  }
+  return true;
+}
+
+GaitFormat::Error GaitArena::checkUpload(const char** name) const {
+  if (_uploadSize == 0 || _uploadReceived != _uploadSize) {
+    return GaitFormat::Error::BAD_SIZE;
+  }
+  GaitFormat::Error error = GaitFormat::validate(_upload, _uploadSize);
+  if (error == GaitFormat::Error::NONE && name != nullptr) {
+    *name = GaitFormat::name(_upload);
+  }
+  return error;
+}
+
+GaitFormat::Error GaitArena::finishUpload(uint8_t* slot) {
+  bool complete = _uploadSize > 0 && _uploadReceived == _uploadSize;
+  size_t size = _uploadReceived;
+  _uploadSize = 0;
+  _uploadReceived = 0;
+  if (!complete) {
+    return GaitFormat::Error::BAD_SIZE;
+  }
+  return load(_upload, size, slot);
+}
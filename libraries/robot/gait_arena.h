@@ -0,0 +1,74 @@
+#ifndef GAIT_ARENA_H
+#define GAIT_ARENA_H
+
+#include "gait_format.h"
+#include "multi_step_gait.h"
+
+/*
+ * Fixed set of gait slots filled at runtime from gait_format.h blobs.
+ *
+ * Everything is preallocated: SLOTS decoded gaits of up to
+ * GaitFormat::MAX_STEPS steps, plus one blob-sized buffer for the upload
+ * in progress - no heap, however many gaits come and go. A blob is only
+ * decoded once it validates, so a bad upload never touches a slot.
+ *
+ * Uploads arrive in pieces over the line-based Bluetooth link:
+ *
+ *   beginUpload(size)  appendHex("4741495401...")...  finishUpload()
+ *
+ * A gait replaces a loaded gait of the same name, otherwise takes a free
+ * slot. Slot data never moves, so MultiStepGait can point at find()'s
+ * result - but reloading a gait that is running changes it underneath,
+ * so stop it first.
+ */
+class GaitArena {
+  public:
+    static const uint8_t SLOTS = 4;
+
+  private:
+    struct Slot {
+      bool used;
+      char name[GaitFormat::NAME_SIZE];
+      GaitStep steps[GaitFormat::MAX_STEPS];
+      LegMovement startPose[Topology::LEG_COUNT];
+      GaitSequenceData data;
+    };
+
+    Slot _slots[SLOTS];
+
+    // Upload in progress
+    uint8_t _upload[GaitFormat::MAX_BLOB_SIZE];
+    size_t _uploadSize;       // Bytes expected
+    size_t _uploadReceived;   // Bytes so far
+
+  public:
+    GaitArena();
+
+    // Validate blob and decode it into a slot. slot gets the slot index
+    GaitFormat::Error load(const uint8_t* blob, size_t size, uint8_t* slot = nullptr);
+
+    // Loaded gait by name, nullptr if none
+    const GaitSequenceData* find(const char* name) const;
+
+    // Loaded gait by slot, nullptr if the slot is free
+    const GaitSequenceData* get(uint8_t slot) const;
+    uint8_t getCount() const;
+
+    // Free the named gait's slot. Returns false if not loaded
+    bool remove(const char* name);
+
+    // Chunked upload - false if size is over MAX_BLOB_SIZE, or the hex
+    // is malformed or runs past the size given (the upload is dropped)
+    bool beginUpload(size_t size);
+    bool appendHex(const char* hex);
+    size_t getUploadReceived() const { return _uploadReceived; }
+
+    // Validate the uploaded blob without loading it (BAD_SIZE if
+    // incomplete). name gets the gait's name, valid until the upload ends
+    GaitFormat::Error checkUpload(const char** name = nullptr) const;
+
+    // Load the uploaded blob (BAD_SIZE if incomplete) and end the upload
+    GaitFormat::Error finishUpload(uint8_t* slot = nullptr);
+};
+
+#endif
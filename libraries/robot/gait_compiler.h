@@ -0,0 +1,147 @@
+#ifndef GAIT_COMPILER_H
+#define GAIT_COMPILER_H
+
+#include <stdint.h>
+#include "board.h"
+#include "joint_motion.h"
+#include "multi_step_gait.h"
+#include "robot_topology.h"
+
+/*
+ * Compile-time gait compiler.
+ *
+ * GaitSequenceData tables hold relative int8_t deltas per leg. Applied as
+ * they are, every step offsets each joint from its target, clamps it,
+ * works out a speed and goes through six virtual applyTo() calls - for
+ * legs that do not move as well. compile() does that work once, at build
+ * time, starting from the pose the cycle starts from (startPose, or middle):
+ *
+ *   target[]    absolute target for every servo after the step
+ *   speed[]     peak speed for each moving servo (Board::servoSpeed)
+ *   activeMask  one bit per servo that moves in the step
+ *   durationMs  time the slowest moving joint takes at its speed
+ *
+ * Applying a compiled step is then a masked copy into JointStates (see
+ * MultiStepGait::applyCompiled). Table mistakes stop the build: the
+ * non-constexpr functions below name the problem in the compiler error
+ * when constant evaluation reaches them.
+ *
+ * Usage (the result must be constexpr for the checks to run at compile time):
+ *   constexpr auto FORWARD_WALK_COMPILED = COMPILE_GAIT(FORWARD_WALK_SEQUENCE);
+ */
+namespace GaitCompiler {
+
+  // One step, resolved to absolute per-servo targets
+  struct CompiledStep {
+    const char* name;
+    uint32_t activeMask;                     // Bit per servo index that moves
+    AngleQ8 target[Topology::SERVO_COUNT];   // Target for every servo after this step
+    SpeedQ16 speed[Topology::SERVO_COUNT];   // Peak speed (moving servos only)
+    uint16_t durationMs;                     // Slowest moving joint at its speed
+    bool waitForCompletion;
+    bool synchronizedArrival;
+  };
+
+  template <uint8_t STEPS>
+  struct CompiledGait {
+    const char* name;
+    bool looping;
+    CompiledStep steps[STEPS];
+  };
+
+  static_assert(Topology::SERVO_COUNT <= 32, "activeMask holds one bit per servo");
+
+  // Compile errors - reached only by a bad table
+  inline void stepCountDoesNotMatchTable() {}
+  inline void gaitTableMovesJointOutsideSafeRange() {}
+  inline void loopingGaitDoesNotReturnToStart() {}
+
+  constexpr const LegMovement& legMovement(const GaitStep& step, uint8_t leg) {
+    return leg == 0 ? step.leftFront :
+           leg == 1 ? step.leftMiddle :
+           leg == 2 ? step.leftRear :
+           leg == 3 ? step.rightFront :
+           leg == 4 ? step.rightMiddle : step.rightRear;
+  }
+
+  constexpr int8_t jointDelta(const LegMovement& movement, uint8_t joint) {
+#if ROBOT_LEG_DOF == 3
+    if (joint == Topology::TIBIA) return movement.tibiaDelta;
+#endif
+    return joint == Topology::SHOULDER ? movement.shoulderDelta : movement.kneeDelta;
+  }
+
+  template <uint8_t STEPS>
+  constexpr CompiledGait<STEPS> compile(const GaitSequenceData& data) {
+    static_assert(STEPS > 0, "A gait needs at least one step");
+
+    CompiledGait<STEPS> gait{};
+    if (data.stepCount != STEPS) {
+      stepCountDoesNotMatchTable();
+    }
+    gait.name = data.name;
+    gait.looping = data.looping;
+
+    AngleQ8 start[Topology::SERVO_COUNT] = {};
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        int8_t offset = data.startPose ? jointDelta(data.startPose[leg], joint) : 0;
+        start[Topology::servoIndex(leg, joint)] =
+          (AngleQ8)((int32_t)Board::servoMiddle() + (int32_t)offset * JointMotion::ONE_DEGREE);
+      }
+    }
+    AngleQ8 pose[Topology::SERVO_COUNT] = {};
+    for (uint8_t servo = 0; servo < Topology::SERVO_COUNT; servo++) {
+      pose[servo] = start[servo];
+    }
+
+    for (uint8_t s = 0; s < STEPS; s++) {
+      const GaitStep& step = data.steps[s];
+      CompiledStep& out = gait.steps[s];
+      out.name = step.name;
+      out.waitForCompletion = step.waitForCompletion;
+      out.synchronizedArrival = step.synchronizedArrival;
+
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        const LegMovement& movement = legMovement(step, leg);
+        for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+          uint8_t servo = Topology::servoIndex(leg, joint);
+          int8_t delta = jointDelta(movement, joint);
+          if (delta != 0) {
+            int32_t target = (int32_t)pose[servo] + (int32_t)delta * JointMotion::ONE_DEGREE;
+            if (target < Board::servoSafeMin() || target > Board::servoSafeMax()) {
+              gaitTableMovesJointOutsideSafeRange();
+            }
+            pose[servo] = (AngleQ8)target;
+
+            // Same speed MultiStepGait::applyDelta() would ask for
+            AngleQ8 distance = JointMotion::degrees(delta < 0 ? -delta : delta);
+            SpeedQ16 speed = Board::servoSpeed(movement.duration, distance);
+            uint32_t ms = (((uint32_t)distance << 8) + speed - 1) / speed;
+            out.speed[servo] = speed;
+            out.activeMask |= 1UL << servo;
+            if (ms > out.durationMs) {
+              out.durationMs = (uint16_t)ms;
+            }
+          }
+          out.target[servo] = pose[servo];
+        }
+      }
+    }
+
+    if (data.looping) {
+      for (uint8_t servo = 0; servo < Topology::SERVO_COUNT; servo++) {
+        if (pose[servo] != start[servo]) {
+          loopingGaitDoesNotReturnToStart();
+        }
+      }
+    }
+    return gait;
+  }
+
+}
+
+// Compile a constexpr GaitSequenceData whose stepCount is known at compile time
+#define COMPILE_GAIT(sequence) GaitCompiler::compile<(sequence).stepCount>(sequence)
+
+#endif
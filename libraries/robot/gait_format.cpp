@@ -0,0 +1,223 @@
+#include "gait_format.h"
+#include "board.h"
+#include <string.h>
+
+namespace GaitFormat {
+
+  static const uint8_t MAGIC[4] = { 'G', 'A', 'I', 'T' };
+
+  // Movement for a leg of a step, by topology index (LF..RR)
+  static LegMovement& legMovement(GaitStep& step, uint8_t leg) {
+    LegMovement* legs[Topology::LEG_COUNT] = {
+      &step.leftFront, &step.leftMiddle, &step.leftRear,
+      &step.rightFront, &step.rightMiddle, &step.rightRear
+    };
+    return *legs[leg];
+  }
+
+  static int8_t* jointDelta(LegMovement& movement, uint8_t joint) {
+#if ROBOT_LEG_DOF == 3
+    if (joint == Topology::TIBIA) return &movement.tibiaDelta;
+#endif
+    return joint == Topology::SHOULDER ? &movement.shoulderDelta : &movement.kneeDelta;
+  }
+
+  static const uint8_t* stepData(const uint8_t* blob, uint8_t index) {
+    bool pose = (blob[7] & FLAG_START_POSE) != 0;
+    return blob + HEADER_SIZE + (pose ? POSE_SIZE : 0) + (size_t)index * STEP_SIZE;
+  }
+
+  const char* errorName(Error error) {
+    switch (error) {
+      case Error::NONE:           return "ok";
+      case Error::TOO_SHORT:      return "too short";
+      case Error::BAD_MAGIC:      return "not a gait";
+      case Error::BAD_VERSION:    return "unsupported version";
+      case Error::WRONG_JOINTS:   return "wrong joints per leg";
+      case Error::BAD_STEP_COUNT: return "bad step count";
+      case Error::BAD_SIZE:       return "size does not match header";
+      case Error::BAD_NAME:       return "bad name";
+      case Error::BAD_CHECKSUM:   return "checksum mismatch";
+      case Error::OUT_OF_RANGE:   return "joint outside safe range";
+      case Error::NOT_CLOSED:     return "looping gait does not return to start";
+      case Error::NO_FREE_SLOT:   return "no free gait slot";
+    }
+    return "unknown";
+  }
+
+  uint32_t crc32(const uint8_t* data, size_t size) {
+    // Bitwise - a blob is checked once per upload, not per frame
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+      crc ^= data[i];
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+      }
+    }
+    return ~crc;
+  }
+
+  Error validate(const uint8_t* blob, size_t size) {
+    if (size < HEADER_SIZE + CRC_SIZE) return Error::TOO_SHORT;
+    if (memcmp(blob, MAGIC, sizeof(MAGIC)) != 0) return Error::BAD_MAGIC;
+    if (blob[4] != VERSION) return Error::BAD_VERSION;
+    if (blob[5] != Topology::JOINTS_PER_LEG) return Error::WRONG_JOINTS;
+    uint8_t steps = blob[6];
+    if (steps == 0 || steps > MAX_STEPS) return Error::BAD_STEP_COUNT;
+    if (size != blobSize(steps, (blob[7] & FLAG_START_POSE) != 0)) return Error::BAD_SIZE;
+
+    const char* gaitName = (const char*)blob + 8;
+    size_t length = strnlen(gaitName, NAME_SIZE);
+    if (length == 0 || length == NAME_SIZE || memchr(gaitName, ' ', length) != nullptr) {
+      return Error::BAD_NAME;
+    }
+
+    uint32_t stored = (uint32_t)blob[size - 4] | ((uint32_t)blob[size - 3] << 8) |
+                      ((uint32_t)blob[size - 2] << 16) | ((uint32_t)blob[size - 1] << 24);
+    if (crc32(blob, size - CRC_SIZE) != stored) return Error::BAD_CHECKSUM;
+
+    // Walk the joints through every step, as GaitCompiler::compile() does
+    LegMovement pose[Topology::LEG_COUNT];
+    startPose(blob, pose);
+    int32_t start[Topology::SERVO_COUNT];
+    int32_t angle[Topology::SERVO_COUNT];
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        uint8_t servo = Topology::servoIndex(leg, joint);
+        start[servo] = (int32_t)Board::servoMiddle() + *jointDelta(pose[leg], joint) * JointMotion::ONE_DEGREE;
+        if (start[servo] < Board::servoSafeMin() || start[servo] > Board::servoSafeMax()) {
+          return Error::OUT_OF_RANGE;
+        }
+        angle[servo] = start[servo];
+      }
+    }
+    for (uint8_t s = 0; s < steps; s++) {
+      GaitStep gaitStep;
+      step(blob, s, gaitStep);
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+          uint8_t servo = Topology::servoIndex(leg, joint);
+          angle[servo] += *jointDelta(legMovement(gaitStep, leg), joint) * JointMotion::ONE_DEGREE;
+          if (angle[servo] < Board::servoSafeMin() || angle[servo] > Board::servoSafeMax()) {
+            return Error::OUT_OF_RANGE;
+          }
+        }
+      }
+    }
+    if (looping(blob)) {
+      for (uint8_t servo = 0; servo < Topology::SERVO_COUNT; servo++) {
+        if (angle[servo] != start[servo]) return Error::NOT_CLOSED;
+      }
+    }
+    return Error::NONE;
+  }
+
+  const char* name(const uint8_t* blob) {
+    return (const char*)blob + 8;
+  }
+
+  uint8_t stepCount(const uint8_t* blob) {
+    return blob[6];
+  }
+
+  bool looping(const uint8_t* blob) {
+    return (blob[7] & FLAG_LOOPING) != 0;
+  }
+
+  bool startPose(const uint8_t* blob, LegMovement* pose) {
+    memset(pose, 0, sizeof(LegMovement) * Topology::LEG_COUNT);
+    if ((blob[7] & FLAG_START_POSE) == 0) {
+      return false;
+    }
+    const uint8_t* in = blob + HEADER_SIZE;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        *jointDelta(pose[leg], joint) = (int8_t)*in++;
+      }
+    }
+    return true;
+  }
+
+  void step(const uint8_t* blob, uint8_t index, GaitStep& step) {
+    const uint8_t* in = stepData(blob, index);
+    memset(&step, 0, sizeof(GaitStep));
+    step.name = name(blob);
+    step.waitForCompletion = (*in & STEP_WAIT) != 0;
+    step.synchronizedArrival = (*in & STEP_SYNCHRONIZED) != 0;
+    in++;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      LegMovement& movement = legMovement(step, leg);
+      movement.duration = (uint16_t)(in[0] | (in[1] << 8));
+      in += 2;
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        *jointDelta(movement, joint) = (int8_t)*in++;
+      }
+    }
+  }
+
+  const GaitStep& stepOf(const GaitSequenceData& data, uint8_t index, GaitStep& buffer) {
+    if (data.steps != nullptr) {
+      return data.steps[index];
+    }
+    step(data.blob, index, buffer);
+    return buffer;
+  }
+
+  void decode(const uint8_t* blob, GaitStep* steps, LegMovement* pose, GaitSequenceData& data) {
+    uint8_t count = stepCount(blob);
+    for (uint8_t s = 0; s < count; s++) {
+      step(blob, s, steps[s]);
+    }
+    bool hasPose = startPose(blob, pose);
+    data = { name(blob), steps, count, looping(blob), hasPose ? pose : nullptr, nullptr };
+  }
+
+  size_t encode(const GaitSequenceData& data, uint8_t* out, size_t capacity) {
+    bool pose = data.startPose != nullptr;
+    size_t size = blobSize(data.stepCount, pose);
+    size_t length = strlen(data.name);
+    if (data.stepCount == 0 || data.stepCount > MAX_STEPS || size > capacity ||
+        length == 0 || length >= NAME_SIZE || strchr(data.name, ' ') != nullptr) {
+      return 0;
+    }
+
+    memset(out, 0, HEADER_SIZE);
+    memcpy(out, MAGIC, sizeof(MAGIC));
+    out[4] = VERSION;
+    out[5] = Topology::JOINTS_PER_LEG;
+    out[6] = data.stepCount;
+    out[7] = (data.looping ? FLAG_LOOPING : 0) | (pose ? FLAG_START_POSE : 0);
+    memcpy(out + 8, data.name, length);
+
+    uint8_t* at = out + HEADER_SIZE;
+    if (pose) {
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        LegMovement movement = data.startPose[leg];
+        for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+          *at++ = (uint8_t)*jointDelta(movement, joint);
+        }
+      }
+    }
+    for (uint8_t s = 0; s < data.stepCount; s++) {
+      GaitStep buffer;
+      GaitStep gaitStep = stepOf(data, s, buffer);
+      *at++ = (gaitStep.waitForCompletion ? STEP_WAIT : 0) |
+              (gaitStep.synchronizedArrival ? STEP_SYNCHRONIZED : 0);
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        LegMovement& movement = legMovement(gaitStep, leg);
+        *at++ = (uint8_t)(movement.duration & 0xFF);
+        *at++ = (uint8_t)(movement.duration >> 8);
+        for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+          *at++ = (uint8_t)*jointDelta(movement, joint);
+        }
+      }
+    }
+
+    uint32_t crc = crc32(out, size - CRC_SIZE);
+    for (uint8_t i = 0; i < CRC_SIZE; i++) {
+      *at++ = (uint8_t)(crc >> (8 * i));
+    }
+    return size;
+  }
+
+}
@@ -0,0 +1,100 @@
+#ifndef GAIT_FORMAT_H
+#define GAIT_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "multi_step_gait.h"
+#include "robot_topology.h"
+
+/*
+ * Compact binary form of a multi-step gait, for loading gaits at runtime
+ * instead of compiling them in. All values little-endian, J = joints per
+ * leg (2, or 3 with ROBOT_LEG_DOF=3):
+ *
+ *   0   4  magic "GAIT"
+ *   4   1  version (VERSION)
+ *   5   1  J - must match the build
+ *   6   1  step count, 1..MAX_STEPS
+ *   7   1  flags: bit 0 looping, bit 1 start pose present
+ *   8  16  name, NUL-terminated and padded (no spaces, at most 15 chars)
+ *  24      start pose if flagged: 6 legs (LF..RR) x J int8 degrees from middle
+ *          steps: 1 byte flags (bit 0 waitForCompletion, bit 1
+ *          synchronizedArrival), then per leg (LF..RR) uint16 duration ms
+ *          and J int8 deltas (shoulder, knee[, tibia])
+ *  end-4 4 CRC-32 (IEEE 802.3) of every byte before it
+ *
+ * validate() checks the framing and checksum, and also walks the deltas
+ * from the start pose the way the gait compiler does: the start pose and
+ * every step must keep each joint within the safe range, and a looping
+ * gait must end where it started.
+ */
+namespace GaitFormat {
+
+  static const uint8_t VERSION = 1;
+  static const uint8_t NAME_SIZE = 16;
+  static const uint8_t HEADER_SIZE = 8 + NAME_SIZE;
+  static const uint8_t CRC_SIZE = 4;
+  static const uint8_t MAX_STEPS = 24;
+
+  static const uint8_t FLAG_LOOPING = 0x01;
+  static const uint8_t FLAG_START_POSE = 0x02;
+  static const uint8_t STEP_WAIT = 0x01;
+  static const uint8_t STEP_SYNCHRONIZED = 0x02;
+
+  static const size_t POSE_SIZE = Topology::LEG_COUNT * Topology::JOINTS_PER_LEG;
+  static const size_t STEP_SIZE = 1 + Topology::LEG_COUNT * (2 + Topology::JOINTS_PER_LEG);
+
+  constexpr size_t blobSize(uint8_t stepCount, bool startPose) {
+    return HEADER_SIZE + (startPose ? POSE_SIZE : 0) + stepCount * STEP_SIZE + CRC_SIZE;
+  }
+
+  static const size_t MAX_BLOB_SIZE = blobSize(MAX_STEPS, true);
+
+  enum class Error : uint8_t {
+    NONE,
+    TOO_SHORT,         // Shorter than a header and checksum
+    BAD_MAGIC,         // Not a gait
+    BAD_VERSION,       // Written for another format version
+    WRONG_JOINTS,      // Written for another leg DOF
+    BAD_STEP_COUNT,    // No steps, or more than MAX_STEPS
+    BAD_SIZE,          // Length does not match the header
+    BAD_NAME,          // Empty, unterminated or contains spaces
+    BAD_CHECKSUM,      // Corrupted in transfer
+    OUT_OF_RANGE,      // Moves a joint past the safe range
+    NOT_CLOSED,        // Looping, but does not return to its start pose
+    NO_FREE_SLOT       // Valid, but there is nowhere to load it (GaitArena)
+  };
+
+  const char* errorName(Error error);
+
+  uint32_t crc32(const uint8_t* data, size_t size);
+
+  // Check a blob completely - the readers below assume it passed
+  Error validate(const uint8_t* blob, size_t size);
+
+  // Readers for a validated blob. name() points into the blob
+  const char* name(const uint8_t* blob);
+  uint8_t stepCount(const uint8_t* blob);
+  bool looping(const uint8_t* blob);
+
+  // Start pose per leg (zeros if the blob has none), false if none
+  bool startPose(const uint8_t* blob, LegMovement* pose);
+
+  // Step index as a GaitStep (name = the gait's name)
+  void step(const uint8_t* blob, uint8_t index, GaitStep& step);
+
+  // Step index of any gait - its table entry, or for a blob-backed gait
+  // (steps == nullptr) the step read into buffer
+  const GaitStep& stepOf(const GaitSequenceData& data, uint8_t index, GaitStep& buffer);
+
+  // The whole gait into caller storage (MAX_STEPS steps, LEG_COUNT pose
+  // entries). Names point into the blob
+  void decode(const uint8_t* blob, GaitStep* steps, LegMovement* pose, GaitSequenceData& data);
+
+  // Write a gait as a blob. Returns its size, or 0 if it does not fit in
+  // capacity or the format (too many steps, name too long or with spaces)
+  size_t encode(const GaitSequenceData& data, uint8_t* out, size_t capacity);
+
+}
+
+#endif
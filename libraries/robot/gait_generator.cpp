@@ -0,0 +1,146 @@
+#include "gait_generator.h"
+#include "phase_gaits.h"
+#include <logging.h>
+#include <string.h>
+
+// Movement for a leg of a step, by topology index (LF..RR)
+static LegMovement& legMovement(GaitStep& step, uint8_t leg) {
+  LegMovement* legs[Topology::LEG_COUNT] = {
+    &step.leftFront, &step.leftMiddle, &step.leftRear,
+    &step.rightFront, &step.rightMiddle, &step.rightRear
+  };
+  return *legs[leg];
+}
+
+static void setJointDelta(LegMovement& movement, uint8_t joint, int8_t delta) {
+#if ROBOT_LEG_DOF == 3
+  if (joint == Topology::TIBIA) {
+    movement.tibiaDelta = delta;
+    return;
+  }
+#endif
+  if (joint == Topology::SHOULDER) {
+    movement.shoulderDelta = delta;
+  } else {
+    movement.kneeDelta = delta;
+  }
+}
+
+// Nearest whole number to num / den (den > 0)
+static int32_t roundDiv(int32_t num, int32_t den) {
+  return num >= 0 ? (num + den / 2) / den : -((-num + den / 2) / den);
+}
+
+// Time within the cycle (out of 256) of a sample
+static uint32_t sampleTime(uint8_t sample) {
+  return ((uint32_t)sample * 256 + GaitGenerator::STEPS_PER_CYCLE / 2) / GaitGenerator::STEPS_PER_CYCLE;
+}
+
+// The phase gaits' leg offsets, so both kinds of gait walk the same pattern
+static const PhaseGaitData& familyPattern(GaitFamily family) {
+  switch (family) {
+    case GaitFamily::RIPPLE: return RIPPLE_PHASE_GAIT;
+    case GaitFamily::WAVE:   return WAVE_PHASE_GAIT;
+    default:                 return TRIPOD_PHASE_GAIT;
+  }
+}
+
+GaitGenerator::GaitGenerator() {
+  memset(_steps, 0, sizeof(_steps));
+  memset(_startPose, 0, sizeof(_startPose));
+  _data = { "Tripod", _steps, STEPS_PER_CYCLE, true, _startPose };
+  _params = { GaitFamily::TRIPOD, 20, DEFAULT_LIFT_DEG, 0, 1200 };  // Same ±10° / 23° as the forward walk
+  generate(_params);
+}
+
+const char* GaitGenerator::familyName(GaitFamily family) {
+  return familyPattern(family).name;
+}
+
+uint8_t GaitGenerator::defaultDutyFactor(GaitFamily family) {
+  return familyPattern(family).dutyFactor;
+}
+
+void GaitGenerator::poseAt(uint32_t time, int16_t* angles) const {
+  uint32_t duty = _params.dutyFactor;
+  int32_t stride = _params.strideDeg;
+  int32_t lift = _params.liftDeg;
+
+  for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+    angles[j] = 0;
+  }
+
+  if (time < duty) {
+    // Stance - foot down, shoulder sweeps from +stride/2 back to -stride/2
+    angles[Topology::SHOULDER] = (int16_t)roundDiv(stride * (int32_t)(duty - 2 * time), 2 * duty);
+    return;
+  }
+
+  // Swing - shoulder sweeps forward again while the knee lifts clear
+  int32_t into = (int32_t)(time - duty);
+  int32_t swing = 256 - (int32_t)duty;
+  int32_t edge = into < swing - into ? into : swing - into;
+  int32_t knee = roundDiv(lift * 4 * edge, swing);
+  angles[Topology::SHOULDER] = (int16_t)roundDiv(stride * (2 * into - swing), 2 * swing);
+  angles[Topology::KNEE] = (int16_t)-(knee < lift ? knee : lift);
+}
+
+bool GaitGenerator::generate(const GaitParameters& params) {
+  uint8_t duty = params.dutyFactor > 0 ? params.dutyFactor : defaultDutyFactor(params.family);
+  if (params.strideDeg < -60 || params.strideDeg > 60 ||
+      params.liftDeg < 0 || params.liftDeg > 60 ||
+      duty < 128 || duty > 240 ||
+      params.periodMs < 10 * STEPS_PER_CYCLE || params.periodMs > 10000) {
+    Log::println("GaitGenerator: parameters out of range");
+    return false;
+  }
+  _params = params;
+  _params.dutyFactor = duty;
+
+  const PhaseGaitData& pattern = familyPattern(params.family);
+  uint16_t stepMs = params.periodMs / STEPS_PER_CYCLE;
+
+  // Poses in whole degrees at every sample, right legs mirrored. Each leg's
+  // offset is rounded to a whole sample so every leg walks the same poses
+  int16_t poses[STEPS_PER_CYCLE][Topology::LEG_COUNT][Topology::JOINTS_PER_LEG];
+  for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+    uint8_t offset = (uint8_t)((pattern.legPhase[leg] * STEPS_PER_CYCLE + 128) / 256);
+    int16_t sign = leg >= Topology::LEG_COUNT / 2 ? -1 : 1;
+    for (uint8_t sample = 0; sample < STEPS_PER_CYCLE; sample++) {
+      poseAt(sampleTime((sample + offset) % STEPS_PER_CYCLE), poses[sample][leg]);
+      for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+        poses[sample][leg][j] *= sign;
+      }
+    }
+  }
+
+  // The cycle starts on the first sample and each step moves to the next,
+  // the last wrapping back to the first
+  memset(_startPose, 0, sizeof(_startPose));
+  memset(_steps, 0, sizeof(_steps));
+  for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+    for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+      setJointDelta(_startPose[leg], j, (int8_t)poses[0][leg][j]);
+    }
+  }
+  for (uint8_t s = 0; s < STEPS_PER_CYCLE; s++) {
+    GaitStep& step = _steps[s];
+    step.name = pattern.name;
+    step.waitForCompletion = true;
+    step.synchronizedArrival = true;
+
+    uint8_t next = (s + 1) % STEPS_PER_CYCLE;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      LegMovement& movement = legMovement(step, leg);
+      movement.duration = stepMs;
+      for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+        setJointDelta(movement, j, (int8_t)(poses[next][leg][j] - poses[s][leg][j]));
+      }
+    }
+  }
+  _data.name = pattern.name;
+
+  Log::println("GaitGenerator: %s, stride %d°, lift %d°, duty %d/256, %ums cycle",
+               pattern.name, params.strideDeg, params.liftDeg, duty, params.periodMs);
+  return true;
+}
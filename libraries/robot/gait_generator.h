@@ -0,0 +1,79 @@
+#ifndef GAIT_GENERATOR_H
+#define GAIT_GENERATOR_H
+
+#include "multi_step_gait.h"
+#include "robot_topology.h"
+
+// Leg phase pattern a generated gait follows (offsets as in phase_gaits.h)
+enum class GaitFamily : uint8_t {
+  TRIPOD,   // Two groups of three alternate
+  RIPPLE,   // Rear-to-front wave per side, the sides half a cycle apart
+  WAVE      // One leg at a time
+};
+
+// What a generated gait looks like - every value can change at runtime
+struct GaitParameters {
+  GaitFamily family;
+  int8_t strideDeg;      // Shoulder sweep per stride in degrees, negative walks backward
+  int8_t liftDeg;        // Knee lift during swing in degrees
+  uint8_t dutyFactor;    // Share of the cycle on the ground, out of 256 (0 = family default)
+  uint16_t periodMs;     // Time for one full cycle
+};
+
+/*
+ * Builds a walking cycle from a handful of parameters instead of a
+ * hand-written table.
+ *
+ * Each leg follows the same path, offset into the cycle by its family's
+ * leg phase: stance pushes the shoulder from +stride/2 to -stride/2 with
+ * the foot down, swing carries it back forward with the knee lifted (up
+ * over the first quarter of the swing, down over the last). The cycle is
+ * sampled at STEPS_PER_CYCLE evenly spaced times and written as ordinary
+ * GaitStep deltas between those poses, each timed to periodMs /
+ * STEPS_PER_CYCLE - so MultiStepGait, blending and transitions run it
+ * like any other table.
+ *
+ * The poses are rounded to whole degrees before the deltas are taken, so
+ * every cycle returns exactly to its start pose. That pose is not the
+ * middle (legs start at their offsets), so it is published as the
+ * sequence's startPose for the transition planner.
+ *
+ * generate() rewrites the same buffers in place - a MultiStepGait built
+ * on getSequenceData() keeps working, and should be restarted so a
+ * transition takes the legs from the old pattern into the new one.
+ */
+class GaitGenerator {
+  public:
+    // Samples per cycle - divides evenly into the tripod, ripple and wave groups
+    static const uint8_t STEPS_PER_CYCLE = 12;
+
+    // Knee lift of the default gait, same as the forward walk
+    static const int8_t DEFAULT_LIFT_DEG = 23;
+
+  private:
+    GaitStep _steps[STEPS_PER_CYCLE];
+    LegMovement _startPose[Topology::LEG_COUNT];
+    GaitSequenceData _data;
+    GaitParameters _params;
+
+    // Left-leg angles (shoulder, knee) in whole degrees at a time within
+    // the cycle, both out of 256
+    void poseAt(uint32_t time, int16_t* angles) const;
+
+  public:
+    GaitGenerator();
+
+    // Rebuild the cycle. Returns false, leaving the last gait in place, if
+    // any parameter is out of range
+    bool generate(const GaitParameters& params);
+
+    const GaitParameters& getParameters() const { return _params; }
+
+    // The generated gait, valid for the lifetime of the generator
+    const GaitSequenceData* getSequenceData() const { return &_data; }
+
+    static const char* familyName(GaitFamily family);
+    static uint8_t defaultDutyFactor(GaitFamily family);
+};
+
+#endif
@@ -0,0 +1,190 @@
+#include "gait_library.h"
+#include <logging.h>
+#include <string.h>
+
+#if !defined(ESP32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const uint8_t MAGIC[4] = { 'G', 'L', 'I', 'B' };
+
+static uint32_t readU32(const uint8_t* in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static void writeU32(uint8_t* out, uint32_t value) {
+  for (uint8_t i = 0; i < 4; i++) {
+    out[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+GaitLibrary::GaitLibrary()
+  : _image(nullptr),
+    _size(0),
+    _count(0),
+    _mapped(nullptr),
+    _mappedSize(0) {
+  _active = { "", nullptr, 0, false, nullptr, nullptr };
+}
+
+GaitLibrary::~GaitLibrary() {
+  close();
+}
+
+bool GaitLibrary::open(const uint8_t* image, size_t size) {
+  _image = nullptr;
+  _size = 0;
+  _count = 0;
+
+  // Erased flash (all 0xFF) fails here too - an empty library, not an error
+  if (size < HEADER_SIZE || memcmp(image, MAGIC, sizeof(MAGIC)) != 0 || image[4] != VERSION) {
+    Log::println("GaitLibrary: no gait library image");
+    return false;
+  }
+  uint8_t count = image[5];
+  size_t indexEnd = HEADER_SIZE + count * ENTRY_SIZE;
+  if (indexEnd > size || GaitFormat::crc32(image + HEADER_SIZE, count * ENTRY_SIZE) != readU32(image + 8)) {
+    Log::println("GaitLibrary: corrupt index");
+    return false;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    const uint8_t* at = image + HEADER_SIZE + i * ENTRY_SIZE;
+    uint32_t offset = readU32(at + GaitFormat::NAME_SIZE);
+    uint32_t length = readU32(at + GaitFormat::NAME_SIZE + 4);
+    if (memchr(at, '\0', GaitFormat::NAME_SIZE) == nullptr ||
+        offset < indexEnd || offset > size || length > size - offset) {
+      Log::println("GaitLibrary: bad index entry %d", i);
+      return false;
+    }
+  }
+
+  _image = image;
+  _size = size;
+  _count = count;
+  Log::println("GaitLibrary: %d gaits", _count);
+  return true;
+}
+
+bool GaitLibrary::openPartition(const char* name) {
+  close();
+
+#if defined(ESP32)
+  const esp_partition_t* partition =
+    esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+  if (partition == nullptr) {
+    Log::println("GaitLibrary: no '%s' partition", name);
+    return false;
+  }
+  const void* data = nullptr;
+  if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA,
+                         &data, &_mapHandle) != ESP_OK) {
+    Log::println("GaitLibrary: cannot map '%s'", name);
+    return false;
+  }
+  _mapped = const_cast<void*>(data);
+  _mappedSize = partition->size;
+#else
+  int fd = ::open(name, O_RDONLY);
+  if (fd < 0) {
+    Log::println("GaitLibrary: cannot open '%s'", name);
+    return false;
+  }
+  struct stat info;
+  void* data = MAP_FAILED;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    Log::println("GaitLibrary: cannot map '%s'", name);
+    return false;
+  }
+  _mapped = data;
+  _mappedSize = (size_t)info.st_size;
+#endif
+
+  if (!open((const uint8_t*)_mapped, _mappedSize)) {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void GaitLibrary::close() {
+  if (_mapped != nullptr) {
+#if defined(ESP32)
+    esp_partition_munmap(_mapHandle);
+#else
+    munmap(_mapped, _mappedSize);
+#endif
+  }
+  _mapped = nullptr;
+  _mappedSize = 0;
+  _image = nullptr;
+  _size = 0;
+  _count = 0;
+  _active = { "", nullptr, 0, false, nullptr, nullptr };
+}
+
+const char* GaitLibrary::getName(uint8_t index) const {
+  return index < _count ? (const char*)entry(index) : nullptr;
+}
+
+const uint8_t* GaitLibrary::findBlob(const char* name, size_t* size) const {
+  for (uint8_t i = 0; i < _count; i++) {
+    const uint8_t* at = entry(i);
+    if (strcmp((const char*)at, name) == 0) {
+      if (size != nullptr) {
+        *size = readU32(at + GaitFormat::NAME_SIZE + 4);
+      }
+      return _image + readU32(at + GaitFormat::NAME_SIZE);
+    }
+  }
+  return nullptr;
+}
+
+const GaitSequenceData* GaitLibrary::select(const char* name) {
+  size_t size = 0;
+  const uint8_t* blob = findBlob(name, &size);
+  if (blob == nullptr) {
+    return nullptr;
+  }
+  GaitFormat::Error error = GaitFormat::validate(blob, size);
+  if (error != GaitFormat::Error::NONE) {
+    Log::println("GaitLibrary: '%s' rejected - %s", name, GaitFormat::errorName(error));
+    return nullptr;
+  }
+  bool hasPose = GaitFormat::startPose(blob, _startPose);
+  _active = { GaitFormat::name(blob), nullptr, GaitFormat::stepCount(blob),
+              GaitFormat::looping(blob), hasPose ? _startPose : nullptr, blob };
+  return &_active;
+}
+
+size_t GaitLibrary::write(const GaitSequenceData* const* gaits, uint8_t count, uint8_t* out, size_t capacity) {
+  size_t at = HEADER_SIZE + count * ENTRY_SIZE;
+  if (at > capacity) {
+    return 0;
+  }
+  memset(out, 0, at);
+
+  for (uint8_t i = 0; i < count; i++) {
+    size_t size = GaitFormat::encode(*gaits[i], out + at, capacity - at);
+    if (size == 0) {
+      return 0;
+    }
+    uint8_t* entryAt = out + HEADER_SIZE + i * ENTRY_SIZE;
+    strncpy((char*)entryAt, gaits[i]->name, GaitFormat::NAME_SIZE - 1);
+    writeU32(entryAt + GaitFormat::NAME_SIZE, (uint32_t)at);
+    writeU32(entryAt + GaitFormat::NAME_SIZE + 4, (uint32_t)size);
+    at += size;
+  }
+
+  memcpy(out, MAGIC, sizeof(MAGIC));
+  out[4] = VERSION;
+  out[5] = count;
+  writeU32(out + 8, GaitFormat::crc32(out + HEADER_SIZE, count * ENTRY_SIZE));
+  return at;
+}
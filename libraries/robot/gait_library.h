@@ -0,0 +1,94 @@
+#ifndef GAIT_LIBRARY_H
+#define GAIT_LIBRARY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gait_format.h"
+#include "multi_step_gait.h"
+
+#if defined(ESP32)
+#include <esp_partition.h>
+#endif
+
+/*
+ * Read-only library of gaits kept in flash, read in place.
+ *
+ * The image is an index followed by gait_format.h blobs (little-endian):
+ *
+ *   0   4  magic "GLIB"
+ *   4   1  version (VERSION)
+ *   5   1  gait count
+ *   6   2  reserved (0)
+ *   8   4  CRC-32 of the index entries
+ *  12      per gait: name[16] (NUL-terminated), uint32 offset from the
+ *          image start, uint32 blob size
+ *          blobs
+ *
+ * On the ESP32 the image lives in its own data partition (see
+ * partitions.csv) and is mapped into the address space with
+ * esp_partition_mmap(), so the index and every blob are read straight
+ * from flash. Host builds mmap() a file in its place. Write an image
+ * with write() and flash it to the partition, e.g.
+ *   esptool.py write_flash 0x310000 gaits.bin
+ *
+ * RAM holds the mapping and the header of one gait - the one select()
+ * last picked - however many gaits the image has. Its steps stay in
+ * flash: MultiStepGait reads the step it is on from the blob, so a gait
+ * of any length costs one GaitStep. Each blob is validated when it is
+ * selected, not when the library opens.
+ */
+class GaitLibrary {
+  public:
+    static const uint8_t VERSION = 1;
+    static const size_t HEADER_SIZE = 12;
+    static const size_t ENTRY_SIZE = GaitFormat::NAME_SIZE + 8;
+
+  private:
+    const uint8_t* _image;
+    size_t _size;
+    uint8_t _count;
+
+#if defined(ESP32)
+    esp_partition_mmap_handle_t _mapHandle;
+#endif
+    void* _mapped;               // Mapping to release in close(), nullptr if none
+    size_t _mappedSize;
+
+    // The selected gait - steps read from its blob
+    LegMovement _startPose[Topology::LEG_COUNT];
+    GaitSequenceData _active;
+
+    const uint8_t* entry(uint8_t index) const { return _image + HEADER_SIZE + index * ENTRY_SIZE; }
+
+  public:
+    GaitLibrary();
+    ~GaitLibrary();
+
+    // Use an image already in memory. Returns false (and stays empty) if
+    // the index is malformed or points outside size
+    bool open(const uint8_t* image, size_t size);
+
+    // Map the image and open it. ESP32: the data partition with this
+    // label. Host builds: the file at this path
+    bool openPartition(const char* name);
+
+    void close();
+
+    uint8_t getCount() const { return _count; }
+    const char* getName(uint8_t index) const;
+
+    // Blob for a gait by name, read in place - nullptr if not in the library
+    const uint8_t* findBlob(const char* name, size_t* size) const;
+
+    // Validate the named gait and make it the active gait, its steps left
+    // in the blob (GaitSequenceData::blob). The result stays valid until
+    // the next select() or close(); nullptr if the gait is missing or its
+    // blob fails validation
+    const GaitSequenceData* select(const char* name);
+
+    // Build an image from gaits. Returns its size, or 0 if it does not fit
+    // in capacity or a gait cannot be encoded
+    static size_t write(const GaitSequenceData* const* gaits, uint8_t count, uint8_t* out, size_t capacity);
+};
+
+#endif
@@ -39,6 +39,18 @@ class GaitSequence {
     // Get current step index (for multi-step gaits)
     // Returns 0 for single-step gaits
     virtual uint8_t getStepIndex() const { return 0; }
+
+    // True if the joints this step moves should all arrive together,
+    // paced by the slowest of them
+    virtual bool synchronizesArrival() const { return false; }
+
+    // True if another step follows this one, so it may blend into it
+    virtual bool hasNextStep() const { return false; }
+
+    // Apply the current step straight into the joint state arrays, if the
+    // sequence has been compiled to absolute targets (see gait_compiler.h).
+    // Returns false to have Body call the applyTo() methods instead
+    virtual bool applyCompiled(JointStates& states) { return false; }
 };
 
 #endif
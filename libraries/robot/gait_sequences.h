@@ -2,13 +2,14 @@
 #define GAIT_SEQUENCES_H
 
 #include "multi_step_gait.h"
+#include "gait_compiler.h"
 
 // Helper macro to calculate array length at compile time
 #define ARRAY_LENGTH(arr) (sizeof(arr) / sizeof(arr[0]))
 
 // Stationary Sequence
 // Robot at rest - no movement on any joints
-const GaitStep STATIONARY_STEPS[] = {
+constexpr GaitStep STATIONARY_STEPS[] = {
   {
     "Stationary",
     {0, 0, 0},  // Left Front: no movement
@@ -21,7 +22,7 @@ const GaitStep STATIONARY_STEPS[] = {
   }
 };
 
-const GaitSequenceData STATIONARY_SEQUENCE = {
+constexpr GaitSequenceData STATIONARY_SEQUENCE = {
   "Stationary",
   STATIONARY_STEPS,
   ARRAY_LENGTH(STATIONARY_STEPS),
@@ -31,7 +32,8 @@ const GaitSequenceData STATIONARY_SEQUENCE = {
 // Forward Walk Sequence
 // Tripod A: Left Front, Left Rear, Right Middle
 // Tripod B: Right Front, Right Rear, Left Middle
-const GaitStep FORWARD_WALK_STEPS[] = {
+// Every joint ends the cycle where it started, so cycles can run back to back
+constexpr GaitStep FORWARD_WALK_STEPS[] = {
   {
     "Lift body",
     {0, -23, 0},           // Left Front: knee -23° (lift)
@@ -72,9 +74,19 @@ const GaitStep FORWARD_WALK_STEPS[] = {
     {0,    0, 0},          // Right Rear: no movement
     true
   },
+  {
+    "Recover",
+    {0,    0, 0},          // Left Front: no movement
+    {-10, +23, 0},         // Left Middle: shoulder and knee back to start
+    {0,    0, 0},          // Left Rear: no movement
+    {+10, -23, 0},         // Right Front: shoulder and knee back to start
+    {0,    0, 0},          // Right Middle: no movement
+    {+10, -23, 0},         // Right Rear: shoulder and knee back to start
+    true
+  },
 };
 
-const GaitSequenceData FORWARD_WALK_SEQUENCE = {
+constexpr GaitSequenceData FORWARD_WALK_SEQUENCE = {
   "Forward Walk",
   FORWARD_WALK_STEPS,
   ARRAY_LENGTH(FORWARD_WALK_STEPS),
@@ -83,11 +95,11 @@ const GaitSequenceData FORWARD_WALK_SEQUENCE = {
 
 // Backward Sequence (servo testing)
 // Oscillates Left Front knee (servo 1) at constant speed
-// Duration 0 = constant 180°/s, so 91° takes ~506ms
-const GaitStep BACKWARD_STEPS[] = {
+// Duration 0 = constant 180°/s, so 88° (middle to servoSafeMax) takes ~489ms
+constexpr GaitStep BACKWARD_STEPS[] = {
   {
     "Backward move",
-    {0, 91, 0},         // Left Front knee: +91° at constant speed
+    {0, 88, 0},         // Left Front knee: +88° at constant speed
     {0, 0, 0},
     {0, 0, 0},
     {0, 0, 0},
@@ -97,7 +109,7 @@ const GaitStep BACKWARD_STEPS[] = {
   },
   {
     "Backward return",
-    {0, -91, 0},        // Left Front knee: -91° at constant speed
+    {0, -88, 0},        // Left Front knee: -88° at constant speed
     {0, 0, 0},
     {0, 0, 0},
     {0, 0, 0},
@@ -107,7 +119,7 @@ const GaitStep BACKWARD_STEPS[] = {
   }
 };
 
-const GaitSequenceData BACKWARD_SEQUENCE = {
+constexpr GaitSequenceData BACKWARD_SEQUENCE = {
   "Backward",
   BACKWARD_STEPS,
   ARRAY_LENGTH(BACKWARD_STEPS),
@@ -116,11 +128,11 @@ const GaitSequenceData BACKWARD_SEQUENCE = {
 
 // Left Sequence (servo testing)
 // Oscillates Left Middle shoulder (servo 2) at constant speed
-const GaitStep LEFT_STEPS[] = {
+constexpr GaitStep LEFT_STEPS[] = {
   {
     "Left move",
     {0, 0, 0},
-    {91, 0, 0},         // Left Middle shoulder: +91° at constant speed
+    {88, 0, 0},         // Left Middle shoulder: +88° at constant speed
     {0, 0, 0},
     {0, 0, 0},
     {0, 0, 0},
@@ -130,7 +142,7 @@ const GaitStep LEFT_STEPS[] = {
   {
     "Left return",
     {0, 0, 0},
-    {-91, 0, 0},        // Left Middle shoulder: -91° at constant speed
+    {-88, 0, 0},        // Left Middle shoulder: -88° at constant speed
     {0, 0, 0},
     {0, 0, 0},
     {0, 0, 0},
@@ -139,7 +151,7 @@ const GaitStep LEFT_STEPS[] = {
   }
 };
 
-const GaitSequenceData LEFT_SEQUENCE = {
+constexpr GaitSequenceData LEFT_SEQUENCE = {
   "Left",
   LEFT_STEPS,
   ARRAY_LENGTH(LEFT_STEPS),
@@ -148,11 +160,11 @@ const GaitSequenceData LEFT_SEQUENCE = {
 
 // Right Sequence (servo testing)
 // Oscillates Left Middle knee (servo 3) at constant speed
-const GaitStep RIGHT_STEPS[] = {
+constexpr GaitStep RIGHT_STEPS[] = {
   {
     "Right move",
     {0, 0, 0},
-    {0, 91, 0},         // Left Middle knee: +91° at constant speed
+    {0, 88, 0},         // Left Middle knee: +88° at constant speed
     {0, 0, 0},
     {0, 0, 0},
     {0, 0, 0},
@@ -162,7 +174,7 @@ const GaitStep RIGHT_STEPS[] = {
   {
     "Right return",
     {0, 0, 0},
-    {0, -91, 0},        // Left Middle knee: -91° at constant speed
+    {0, -88, 0},        // Left Middle knee: -88° at constant speed
     {0, 0, 0},
     {0, 0, 0},
     {0, 0, 0},
@@ -171,11 +183,19 @@ const GaitStep RIGHT_STEPS[] = {
   }
 };
 
-const GaitSequenceData RIGHT_SEQUENCE = {
+constexpr GaitSequenceData RIGHT_SEQUENCE = {
   "Right",
   RIGHT_STEPS,
   ARRAY_LENGTH(RIGHT_STEPS),
   false  // Don't loop
 };
 
+// Compiled forms of the sequences above - absolute targets, speeds and
+// active-servo masks worked out at build time (see gait_compiler.h)
+constexpr auto STATIONARY_COMPILED = COMPILE_GAIT(STATIONARY_SEQUENCE);
+constexpr auto FORWARD_WALK_COMPILED = COMPILE_GAIT(FORWARD_WALK_SEQUENCE);
+constexpr auto BACKWARD_COMPILED = COMPILE_GAIT(BACKWARD_SEQUENCE);
+constexpr auto LEFT_COMPILED = COMPILE_GAIT(LEFT_SEQUENCE);
+constexpr auto RIGHT_COMPILED = COMPILE_GAIT(RIGHT_SEQUENCE);
+
 #endif
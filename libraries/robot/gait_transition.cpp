@@ -0,0 +1,184 @@
+#include "gait_transition.h"
+#include "gait_format.h"
+#include <logging.h>
+#include <string.h>
+
+// Tripod A legs (LF, LR, RM) move in the first keyframes, tripod B in the last
+static const bool TRIPOD_A[Topology::LEG_COUNT] = { true, false, true, false, true, false };
+
+// As much of a move as one int8_t delta holds
+static int8_t clampDelta(int16_t move) {
+  if (move > INT8_MAX) return INT8_MAX;
+  if (move < INT8_MIN) return INT8_MIN;
+  return (int8_t)move;
+}
+
+// Movement for a leg of a step, by topology index (LF..RR)
+static const LegMovement& legMovement(const GaitStep& step, uint8_t leg) {
+  const LegMovement* legs[Topology::LEG_COUNT] = {
+    &step.leftFront, &step.leftMiddle, &step.leftRear,
+    &step.rightFront, &step.rightMiddle, &step.rightRear
+  };
+  return *legs[leg];
+}
+
+static int8_t jointDelta(const LegMovement& movement, uint8_t joint) {
+#if ROBOT_LEG_DOF == 3
+  if (joint == Topology::TIBIA) return movement.tibiaDelta;
+#endif
+  return joint == Topology::SHOULDER ? movement.shoulderDelta : movement.kneeDelta;
+}
+
+static void setJointDelta(LegMovement& movement, uint8_t joint, int8_t delta) {
+#if ROBOT_LEG_DOF == 3
+  if (joint == Topology::TIBIA) {
+    movement.tibiaDelta = delta;
+    return;
+  }
+#endif
+  if (joint == Topology::SHOULDER) {
+    movement.shoulderDelta = delta;
+  } else {
+    movement.kneeDelta = delta;
+  }
+}
+
+GaitTransition::GaitTransition()
+  : _entryStep(0) {
+  _data = { "Transition", _steps, 0, false, nullptr };
+}
+
+void GaitTransition::entryPose(const GaitSequenceData* gait, uint8_t step, Pose& pose) {
+  for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+    for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+      pose[leg][joint] = gait->startPose ? jointDelta(gait->startPose[leg], joint) : 0;
+    }
+  }
+  for (uint8_t s = 0; s < step; s++) {
+    GaitStep buffer;
+    const GaitStep& gaitStep = GaitFormat::stepOf(*gait, s, buffer);
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        pose[leg][joint] += jointDelta(legMovement(gaitStep, leg), joint);
+      }
+    }
+  }
+}
+
+const GaitSequenceData* GaitTransition::plan(Body& body, const GaitSequenceData* target) {
+  // Where the legs are heading, in whole degrees from middle
+  Pose current;
+  AngleQ8 middle = _board.servoMiddle();
+  for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+    for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+      int32_t offset = (int32_t)body.leg(leg).joint(joint).getTarget() - middle;
+      int32_t half = offset < 0 ? -JointMotion::ONE_DEGREE / 2 : JointMotion::ONE_DEGREE / 2;
+      current[leg][joint] = (int16_t)((offset + half) / JointMotion::ONE_DEGREE);
+    }
+  }
+
+  // Nearest entry pose - fewest degrees for the joint that moves furthest,
+  // then fewest degrees overall, then the earliest step
+  Pose best;
+  int32_t bestLargest = INT32_MAX;
+  int32_t bestTotal = INT32_MAX;
+  for (uint8_t step = 0; step < target->stepCount; step++) {
+    Pose pose;
+    entryPose(target, step, pose);
+
+    int32_t largest = 0;
+    int32_t total = 0;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        int32_t move = pose[leg][joint] - current[leg][joint];
+        if (move < 0) move = -move;
+        if (move > largest) largest = move;
+        total += move;
+      }
+    }
+
+    if (largest < bestLargest || (largest == bestLargest && total < bestTotal)) {
+      bestLargest = largest;
+      bestTotal = total;
+      _entryStep = step;
+      memcpy(best, pose, sizeof(Pose));
+    }
+  }
+
+  // Lift, swing and lower keyframes per tripod, skipping any with nothing
+  // to move and repeating any that moves a joint further than one delta
+  static const char* const NAMES[KEYFRAME_KINDS] = {
+    "Lift A", "Swing A", "Lower A", "Lift B", "Swing B", "Lower B"
+  };
+  static const uint8_t LIFT = 0;
+  static const uint8_t SWING = 1;
+  static const uint8_t LOWER = 2;
+  _data.stepCount = 0;
+  for (uint8_t keyframe = 0; keyframe < KEYFRAME_KINDS; keyframe++) {
+    uint8_t phase = keyframe % 3;
+
+    // Whole move of each joint in this keyframe
+    Pose moves;
+    bool moving = false;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        moves[leg][joint] = 0;
+      }
+      if (TRIPOD_A[leg] != (keyframe < 3)) {
+        continue;
+      }
+
+      bool swings = false;
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        swings = swings || (joint != Topology::KNEE && best[leg][joint] != current[leg][joint]);
+      }
+
+      // Lifted knee, as GaitGenerator lifts (up is negative on the left,
+      // mirrored on the right) - or higher, if either pose already is
+      int16_t sign = leg >= Topology::LEG_COUNT / 2 ? -1 : 1;
+      int16_t lifted = -GaitGenerator::DEFAULT_LIFT_DEG;
+      if (sign * current[leg][Topology::KNEE] < lifted) lifted = sign * current[leg][Topology::KNEE];
+      if (sign * best[leg][Topology::KNEE] < lifted) lifted = sign * best[leg][Topology::KNEE];
+      lifted *= sign;
+      int16_t kneeFrom = swings ? lifted : current[leg][Topology::KNEE];
+
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        int16_t move = 0;
+        if (joint == Topology::KNEE) {
+          if (phase == LIFT && swings) move = lifted - current[leg][joint];
+          if (phase == LOWER) move = best[leg][joint] - kneeFrom;
+        } else if (phase == SWING) {
+          move = best[leg][joint] - current[leg][joint];
+        }
+        moves[leg][joint] = move;
+        moving = moving || move != 0;
+      }
+    }
+
+    // A delta is one int8_t - a longer move takes another keyframe
+    while (moving && _data.stepCount < MAX_STEPS) {
+      GaitStep& step = _steps[_data.stepCount++];
+      memset(&step, 0, sizeof(GaitStep));
+      step.name = NAMES[keyframe];
+      step.waitForCompletion = true;
+
+      LegMovement* legs[Topology::LEG_COUNT] = {
+        &step.leftFront, &step.leftMiddle, &step.leftRear,
+        &step.rightFront, &step.rightMiddle, &step.rightRear
+      };
+      moving = false;
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+          int8_t delta = clampDelta(moves[leg][joint]);
+          setJointDelta(*legs[leg], joint, delta);
+          moves[leg][joint] -= delta;
+          moving = moving || moves[leg][joint] != 0;
+        }
+      }
+    }
+  }
+
+  Log::debugln("GaitTransition: into '%s' step %d, %d keyframes, %ld° furthest",
+               target->name, _entryStep, _data.stepCount, (long)bestLargest);
+  return &_data;
+}
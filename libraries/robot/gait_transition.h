@@ -0,0 +1,69 @@
+#ifndef GAIT_TRANSITION_H
+#define GAIT_TRANSITION_H
+
+#include "multi_step_gait.h"
+#include "gait_generator.h"
+#include "body.h"
+#include "robot_topology.h"
+
+/*
+ * Plans a direct change from whatever the legs are doing into another
+ * multi-step gait, without going back to stationary first.
+ *
+ * Every gait cycle starts from its startPose (the middle pose unless the
+ * data gives one), so the pose before each step is that plus the deltas
+ * of the steps ahead of it. plan()
+ * compares the legs' current targets with each of those entry poses,
+ * picks the nearest (smallest largest joint move), and writes the
+ * keyframes that get there as a short non-looping sequence. Each tripod
+ * (Left Front, Left Rear, Right Middle, then Right Front, Right Rear,
+ * Left Middle) steps into the entry pose in three keyframes:
+ *
+ *   "Lift A/B"   knees up by GaitGenerator::DEFAULT_LIFT_DEG, so the feet
+ *                clear the ground
+ *   "Swing A/B"  shoulders (and tibias) to the entry pose
+ *   "Lower A/B"  knees down to the entry pose
+ *
+ * One tripod moves at a time so the other three legs keep holding the
+ * body up. A leg whose shoulder stays put moves its knee straight in the
+ * lower keyframe. Keyframes with nothing to move are left out - a leg
+ * state already on an entry pose needs none, and the new gait starts
+ * there. Deltas are whole degrees in an int8_t, so a keyframe that moves
+ * a joint more than 127° is split in two of the same name - the gait is
+ * always entered from its real entry pose.
+ */
+class GaitTransition {
+  public:
+    // Lift, swing and lower for each tripod, each split in two at most
+    // (no joint moves more than twice INT8_MAX degrees within its range)
+    static const uint8_t KEYFRAME_KINDS = 6;
+    static const uint8_t MAX_STEPS = KEYFRAME_KINDS * 2;
+
+  private:
+    Board _board;
+    GaitStep _steps[MAX_STEPS];
+    GaitSequenceData _data;
+    uint8_t _entryStep;
+
+    // Joint angles in whole degrees from middle, by leg and joint slot
+    using Pose = int16_t[Topology::LEG_COUNT][Topology::JOINTS_PER_LEG];
+
+    // The pose the gait is in just before applying step
+    static void entryPose(const GaitSequenceData* gait, uint8_t step, Pose& pose);
+
+  public:
+    GaitTransition();
+
+    // Plan the keyframes from body's current targets into the nearest step
+    // of target. The returned sequence is owned here and valid until the
+    // next plan(); it may have no steps
+    const GaitSequenceData* plan(Body& body, const GaitSequenceData* target);
+
+    // Step of the target gait the planned keyframes lead into
+    uint8_t getEntryStep() const { return _entryStep; }
+
+    // The last planned keyframes
+    const GaitSequenceData* getSequenceData() const { return &_data; }
+};
+
+#endif
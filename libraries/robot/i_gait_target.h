@@ -2,6 +2,8 @@
 #define I_GAIT_TARGET_H
 
 #include <stdint.h>
+#include <functional>
+#include "leg_kinematics.h"
 
 // Forward declaration
 class GaitSequence;
@@ -15,6 +17,9 @@ class GaitSequence;
  */
 class IGaitTarget {
   public:
+    // Motion complete callback type
+    using MotionCompleteCallback = std::function<void()>;
+
     virtual ~IGaitTarget() = default;
 
     // Apply a gait sequence (sets joint targets)
@@ -26,9 +31,21 @@ class IGaitTarget {
     // Check if all joints have reached their targets
     virtual bool atTarget() const = 0;
 
+    // Register a callback fired from update() once all joints have
+    // arrived - exactly once per applied gait step or reset
+    virtual void onMotionComplete(MotionCompleteCallback callback) = 0;
+
     // Reset all joints to middle position (90 degrees)
     virtual void resetToMiddle() = 0;
 
+    // Move a leg's foot to a position in mm in the leg's own frame
+    // (leg_kinematics.h) in durationMs. Returns false without moving if
+    // it is out of reach or past the safe range
+    virtual bool setFootTarget(uint8_t leg, const FootPosition& foot, uint32_t durationMs) = 0;
+
+    // Where a leg's foot is now, in the same frame
+    virtual FootPosition getFootPosition(uint8_t leg) const = 0;
+
     // Get a description of current state (for logging/debugging)
     virtual void logState() const = 0;
 };
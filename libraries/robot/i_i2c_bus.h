@@ -0,0 +1,30 @@
+#ifndef I_I2C_BUS_H
+#define I_I2C_BUS_H
+
+#include <stdint.h>
+
+/**
+ * Interface for an I2C bus master.
+ *
+ * Each call is exactly one bus transaction (start, address, data, stop).
+ * This abstraction allows device drivers to run against:
+ * - Real hardware (WireBus on the ESP32 Wire peripheral)
+ * - Test implementations (MockPca9685 counting transactions and bytes)
+ */
+class II2cBus {
+  public:
+    virtual ~II2cBus() = default;
+
+    // Write bytes to a device in a single transaction
+    // Returns true if the device acknowledged every byte
+    virtual bool write(uint8_t address, const uint8_t* data, uint8_t length) = 0;
+
+    // Set the register pointer and read bytes back (repeated start)
+    // Returns true if all requested bytes were received
+    virtual bool read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) = 0;
+
+    // Change the SCL clock rate
+    virtual bool setClock(uint32_t hz) = 0;
+};
+
+#endif
@@ -3,47 +3,54 @@
 
 #include <stdint.h>
 #include <servo.h>
-#include <profiler.h>
+#include <joint_motion.h>
+#include <joint_states.h>
 
 /*
- * Base class for joints (Shoulder, Knee).
+ * Base class for joints (Shoulder, Knee, Tibia).
  *
- * Provides time-based movement with speed control.
- * Joints move smoothly from current position to target position
- * over time based on configured speed.
+ * A thin view over one slot of Body's JointStates (the slot is the servo
+ * number), pairing it with the servo it drives. Each setTarget() plans a
+ * timed move from the current position; Body evaluates all of them at the
+ * frame time in one loop (JointStates::update) and ServoWriteScheduler
+ * decides which of them are written each frame.
+ *
+ * Positions are Q8.8 degrees and speeds Q16.16 degrees/ms, planned and
+ * evaluated by motion_profile.h - the same kernel MockJoint runs on the host.
  */
 class Joint {
   protected:
     Servo &_servo;
-    float _currentPos;   // Current angle in degrees
-    float _targetPos;    // Target angle in degrees
-    float _speed;        // Degrees per second
-
-    // Rate limiting for servo writes
-    CallRateProfiler _servoWriteProfiler;
+    JointStates &_states;
+    uint8_t _index;
 
   public:
-    Joint(Servo &servo, float initialPos);
-
-    // Update joint position based on elapsed time
-    virtual void update(uint32_t deltaMs);
+    Joint(Servo &servo, JointStates &states, AngleQ8 initialPos);
 
     // Set target position and speed
-    void setTarget(float targetPos, float speed);
+    void setTarget(AngleQ8 targetPos, SpeedQ16 speed);
+
+    // Same, in degrees and degrees per second (commands and tests)
+    void setTargetDegrees(float targetDeg, float speedDps);
+
+    // Set target position, arriving exactly durationMs from now
+    void setTargetTimed(AngleQ8 targetPos, uint32_t durationMs) { _states.setTargetTimed(_index, targetPos, durationMs); }
+
+    // Velocity profile and limits for subsequent targets (see motion_profile.h)
+    void setProfile(ProfileType type, const MotionLimits& limits) { _states.setProfile(_index, type, limits); }
+    ProfileType getProfile() const { return _states.getProfile(_index); }
 
     // Get current position
-    float getPosition() const { return _currentPos; }
+    AngleQ8 getPosition() const { return _states.getPosition(_index); }
 
     // Get target position
-    float getTarget() const { return _targetPos; }
+    AngleQ8 getTarget() const { return _states.getTarget(_index); }
 
-    // Check if joint has reached target
-    bool atTarget() const { return abs(_currentPos - _targetPos) < 0.5f; }
+    // Check if joint has reached target (exactly - moves end on their target)
+    bool atTarget() const { return _states.atTarget(_index); }
 
-    // Profiling control
-    void enableServoWriteProfiling(bool enabled);
-    void setServoWriteRateLimit(uint32_t minIntervalMs);
-    CallRateProfiler& getServoWriteProfiler();
+    // Servo this joint drives (written by ServoWriteScheduler)
+    Servo& getServo() { return _servo; }
 };
 
 #endif
@@ -0,0 +1,63 @@
+#ifndef JOINT_MOTION_H
+#define JOINT_MOTION_H
+
+#include <stdint.h>
+
+/*
+ * Fixed-point angles and speeds shared by Joint (robot) and MockJoint
+ * (host simulation), so both move through exactly the same positions.
+ *
+ * Angles are Q8.8 degrees (1/256°, 0-255.99°) and speeds are Q16.16
+ * degrees per millisecond. Moves are planned and evaluated in
+ * motion_profile.h, and the Q8.8 angle indexes the servo's PWM table
+ * directly (whole degree = angle >> 8).
+ */
+typedef uint16_t AngleQ8;
+typedef uint32_t SpeedQ16;
+
+namespace JointMotion {
+
+  static const AngleQ8 ONE_DEGREE = 256;
+
+  constexpr AngleQ8 degrees(uint8_t deg) {
+    return (AngleQ8)(deg * ONE_DEGREE);
+  }
+
+  constexpr SpeedQ16 degreesPerSecond(uint32_t dps) {
+    return (dps << 16) / 1000;
+  }
+
+  // Conversions for commands and logging (not used per tick)
+  inline AngleQ8 fromDegrees(float deg) {
+    if (deg <= 0.0f) return 0;
+    if (deg >= 255.0f) return degrees(255);
+    return (AngleQ8)(deg * ONE_DEGREE + 0.5f);
+  }
+
+  inline float toDegrees(AngleQ8 angle) {
+    return angle / (float)ONE_DEGREE;
+  }
+
+  inline SpeedQ16 fromDegreesPerSecond(float dps) {
+    return dps > 0.0f ? (SpeedQ16)(dps * 65.536f + 0.5f) : 0;
+  }
+
+  inline float toDegreesPerSecond(SpeedQ16 speed) {
+    return speed / 65.536f;
+  }
+
+  inline AngleQ8 distance(AngleQ8 a, AngleQ8 b) {
+    return a > b ? a - b : b - a;
+  }
+
+  // Target for a relative move of deltaDeg whole degrees, clamped to [min, max]
+  inline AngleQ8 offset(AngleQ8 pos, int8_t deltaDeg, AngleQ8 min, AngleQ8 max) {
+    int32_t target = (int32_t)pos + (int32_t)deltaDeg * ONE_DEGREE;
+    if (target < min) return min;
+    if (target > max) return max;
+    return (AngleQ8)target;
+  }
+
+}
+
+#endif
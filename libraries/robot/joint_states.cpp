@@ -0,0 +1,177 @@
+#include <joint_states.h>
+#include <board.h>
+
+JointStates::JointStates()
+  : _blending(false),
+    _nowMs(0),
+    _moving(0),
+    _stepMask(0) {
+  for (uint8_t i = 0; i < COUNT; i++) {
+    _current[i] = JointMotion::degrees(90);
+    _target[i] = _current[i];
+    _speed[i] = JointMotion::degreesPerSecond(90);
+    _profile[i] = ProfileType::CONSTANT;
+    _limits[i] = { 0, 0 };
+    _plan[i] = MotionProfile::plan(ProfileType::CONSTANT, _current[i], _target[i], _speed[i], _limits[i]);
+    _startMs[i] = 0;
+    _blendActive[i] = false;
+  }
+}
+
+void JointStates::reset(uint8_t index, AngleQ8 angle) {
+  if (!atTarget(index)) {
+    _moving--;
+  }
+  _current[index] = angle;
+  _target[index] = angle;
+  _speed[index] = JointMotion::degreesPerSecond(90);  // Default 90 degrees per second
+  _plan[index] = MotionProfile::plan(ProfileType::CONSTANT, angle, angle, _speed[index], _limits[index]);
+  _startMs[index] = _nowMs;
+  _blendActive[index] = false;
+}
+
+void JointStates::countMove(uint8_t index, bool wasMoving) {
+  bool nowMoving = !atTarget(index);
+  if (nowMoving && !wasMoving) {
+    _moving++;
+  } else if (wasMoving && !nowMoving) {
+    _moving--;
+  }
+}
+
+void JointStates::setTarget(uint8_t index, AngleQ8 target, SpeedQ16 speed) {
+  bool wasMoving = !atTarget(index);
+
+  // Blend into the unfinished move - plan from where it was heading and
+  // keep it to add its remainder on top. A reversal (or a target short of
+  // the old one) starts from the current position instead, as does one
+  // arriving mid-blend - only one remainder is kept, so blending again
+  // would drop the older one and jump
+  AngleQ8 from = _current[index];
+  const MotionPlan& old = _plan[index];
+  bool onward = old.target > old.start ? target > old.target : target < old.target;
+  _blendActive[index] = _blending && wasMoving && !_blendActive[index] &&
+                        old.target != old.start && onward;
+  if (_blendActive[index]) {
+    _blendPlan[index] = _plan[index];
+    _blendStartMs[index] = _startMs[index];
+    _blendFrom[index] = _current[index];
+    from = _plan[index].target;
+  }
+
+  _target[index] = target;
+  _speed[index] = speed;
+  _plan[index] = MotionProfile::plan(_profile[index], from, target, speed, _limits[index]);
+  _startMs[index] = _nowMs;
+  _stepMask |= 1UL << index;
+  countMove(index, wasMoving);
+}
+
+void JointStates::applyStep(uint32_t mask, const AngleQ8* targets, const SpeedQ16* speeds) {
+  while (mask != 0) {
+    uint8_t i = __builtin_ctz(mask);
+    setTarget(i, targets[i], speeds[i]);
+    mask &= mask - 1;
+  }
+}
+
+void JointStates::setTargetTimed(uint8_t index, AngleQ8 target, uint32_t durationMs) {
+  bool wasMoving = !atTarget(index);
+  _target[index] = target;
+  _plan[index] = MotionProfile::planTimed(_profile[index], _current[index], target, durationMs, _limits[index]);
+  _startMs[index] = _nowMs;
+  _blendActive[index] = false;
+  countMove(index, wasMoving);
+}
+
+uint32_t JointStates::getArrivalTime(uint8_t index) const {
+  uint32_t arrival = _startMs[index] + _plan[index].durationMs;
+  if (_blendActive[index]) {
+    uint32_t blendEnd = _blendStartMs[index] + _blendPlan[index].durationMs;
+    if (blendEnd > arrival) {
+      arrival = blendEnd;
+    }
+  }
+  return arrival;
+}
+
+bool JointStates::allWithin(AngleQ8 radius) const {
+  for (uint8_t i = 0; i < COUNT; i++) {
+    if (JointMotion::distance(_current[i], _target[i]) > radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void JointStates::setProfile(uint8_t index, ProfileType type, const MotionLimits& limits) {
+  _profile[index] = type;
+  _limits[index] = limits;
+}
+
+bool JointStates::advanceTo(uint32_t nowMs) {
+  _nowMs = nowMs;
+  if (_moving == 0) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < COUNT; i++) {
+    if (atTarget(i)) {
+      continue;
+    }
+    AngleQ8 pos = MotionProfile::evaluate(_plan[i], nowMs - _startMs[i]);
+    if (_blendActive[i]) {
+      // Add what is left of the previous move until it ends
+      const MotionPlan& prev = _blendPlan[i];
+      uint32_t elapsed = nowMs - _blendStartMs[i];
+      if (elapsed >= prev.durationMs) {
+        _blendActive[i] = false;
+      } else {
+        int32_t blended = (int32_t)pos + (int32_t)MotionProfile::evaluate(prev, elapsed) - (int32_t)prev.target;
+
+        // A new move faster than the old one's remainder (a reversal) would
+        // carry the sum past the target - hold it between where the blend
+        // began and the new target, and inside the safe range
+        int32_t low = _blendFrom[i] < _target[i] ? _blendFrom[i] : _target[i];
+        int32_t high = _blendFrom[i] < _target[i] ? _target[i] : _blendFrom[i];
+        if (blended < low) blended = low;
+        if (blended > high) blended = high;
+        if (blended < Board::servoSafeMin()) blended = Board::servoSafeMin();
+        if (blended > Board::servoSafeMax()) blended = Board::servoSafeMax();
+        pos = (AngleQ8)blended;
+      }
+    }
+    _current[i] = pos;
+    // Arrived once on the target with the old move over too
+    if (atTarget(i)) {
+      _moving--;
+    }
+  }
+  return _moving == 0;
+}
+
+void JointStates::synchronizeArrival(uint32_t mask) {
+  // Only this step's joints - an overlapped step applied in the same
+  // frame keeps its own timing. Unmasked moves started earlier are left too
+  for (uint8_t i = 0; i < COUNT; i++) {
+    if (_startMs[i] != _nowMs || atTarget(i)) {
+      mask &= ~(1UL << i);
+    }
+  }
+
+  // Stretched to the slowest of them
+  uint32_t longest = 0;
+  for (uint32_t m = mask; m != 0; m &= m - 1) {
+    uint8_t i = __builtin_ctz(m);
+    if (_plan[i].durationMs > longest) {
+      longest = _plan[i].durationMs;
+    }
+  }
+
+  for (uint32_t m = mask; m != 0; m &= m - 1) {
+    uint8_t i = __builtin_ctz(m);
+    if (_plan[i].durationMs != longest) {
+      _plan[i] = MotionProfile::planTimed(_profile[i], _plan[i].start, _target[i], longest, _limits[i]);
+    }
+  }
+}
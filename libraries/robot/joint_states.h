@@ -0,0 +1,128 @@
+#ifndef JOINT_STATES_H
+#define JOINT_STATES_H
+
+#include <stdint.h>
+#include <joint_motion.h>
+#include <motion_profile.h>
+#include <robot_topology.h>
+
+/*
+ * Motion state for every joint, stored as parallel arrays.
+ *
+ * Body owns one of these; Joint and Leg are thin views that index into
+ * it by servo number (see robot_topology.h). The per-tick update is one
+ * non-virtual loop over contiguous arrays, so the kernel can be
+ * benchmarked on its own.
+ *
+ * setTarget() plans each move (see motion_profile.h) and records the
+ * time it started. update() advances a single clock by whole control
+ * frames and evaluates every moving joint at that time, so positions
+ * depend only on the frame time - not on how it was reached - and a
+ * joint is on its target exactly when its move's duration has passed.
+ *
+ * With blending on, a new target for a joint still on its way is
+ * superimposed on the unfinished move: the new move runs from the old
+ * target, and what is left of the old move is added on top until it
+ * ends. The joint keeps moving through the change of target instead of
+ * stopping on the old one, and still lands exactly on the new target.
+ * Only a target further along the same direction is blended - one that
+ * turns the joint back, or arrives while a blend is still running, is
+ * planned from where the joint is. The sum is held between where the
+ * blend began and the new target (and within the servo's safe range).
+ *
+ * A count of joints not on their target is kept up to date as targets
+ * are set and joints arrive, so allAtTarget() is constant time. All
+ * writes go through reset(), setTarget() and update()/advanceTo() so the
+ * count stays right.
+ */
+class JointStates {
+  public:
+    static const uint8_t COUNT = Topology::SERVO_COUNT;
+
+  private:
+    AngleQ8 _current[COUNT];   // Q8.8 degrees
+    AngleQ8 _target[COUNT];    // Q8.8 degrees
+    SpeedQ16 _speed[COUNT];    // Q16.16 degrees per millisecond (peak speed)
+    ProfileType _profile[COUNT];
+    MotionLimits _limits[COUNT];
+    MotionPlan _plan[COUNT];   // Current move
+    uint32_t _startMs[COUNT];  // Clock time the current move started
+    MotionPlan _blendPlan[COUNT];   // Unfinished previous move, while blending
+    uint32_t _blendStartMs[COUNT];
+    AngleQ8 _blendFrom[COUNT];      // Position when the blend began
+    bool _blendActive[COUNT];
+    bool _blending;            // Blend new targets into unfinished moves
+    uint32_t _nowMs;           // Clock time of the last update
+    uint8_t _moving;           // Joints not on their target
+    uint32_t _stepMask;        // Joints given a target since beginStep()
+
+    // Keep the moving count right after a joint's target changed
+    void countMove(uint8_t index, bool wasMoving);
+
+  public:
+    JointStates();
+
+    // Put a joint at rest at angle
+    void reset(uint8_t index, AngleQ8 angle);
+
+    // Plan a move from the current position to target, starting now
+    void setTarget(uint8_t index, AngleQ8 target, SpeedQ16 speed);
+
+    // setTarget() for every servo whose bit is set in mask, from arrays
+    // indexed by servo (a compiled gait step - see gait_compiler.h)
+    void applyStep(uint32_t mask, const AngleQ8* targets, const SpeedQ16* speeds);
+
+    // Plan a move from the current position to target, starting now and
+    // taking exactly durationMs (speed follows from the distance)
+    void setTargetTimed(uint8_t index, AngleQ8 target, uint32_t durationMs);
+
+    // Blend setTarget() into moves still under way (see above)
+    void setBlending(bool enabled) { _blending = enabled; }
+    bool getBlending() const { return _blending; }
+
+    // True when every joint is within radius of its target
+    bool allWithin(AngleQ8 radius) const;
+
+    // Velocity profile used from the next setTarget() on
+    void setProfile(uint8_t index, ProfileType type, const MotionLimits& limits);
+
+    // Start recording which joints setTarget() moves, for synchronizeArrival()
+    void beginStep() { _stepMask = 0; }
+    uint32_t getStepMask() const { return _stepMask; }
+
+    // Re-time the moves of the joints in mask started this frame to arrive
+    // with the slowest of them. Moves are only ever slowed down, so speed
+    // limits still hold
+    void synchronizeArrival(uint32_t mask);
+
+    // Advance the clock by deltaMs and move every joint to where its plan has it
+    // Returns true if the last moving joint arrived during this call
+    bool update(uint32_t deltaMs) { return advanceTo(_nowMs + deltaMs); }
+
+    // Same, jumping the clock straight to nowMs (which must not be behind it)
+    bool advanceTo(uint32_t nowMs);
+
+    uint32_t getTime() const { return _nowMs; }
+
+    AngleQ8 getPosition(uint8_t index) const { return _current[index]; }
+    AngleQ8 getTarget(uint8_t index) const { return _target[index]; }
+    SpeedQ16 getSpeed(uint8_t index) const { return _speed[index]; }
+    ProfileType getProfile(uint8_t index) const { return _profile[index]; }
+    const MotionPlan& getPlan(uint8_t index) const { return _plan[index]; }
+
+    // Clock time the joint arrives (or arrived) at its target
+    uint32_t getArrivalTime(uint8_t index) const;
+
+    // On the target and staying there (no blended move still running)
+    bool atTarget(uint8_t index) const {
+      return _current[index] == _target[index] && !_blendActive[index];
+    }
+
+    // Number of joints still moving towards their target
+    uint8_t getMovingCount() const { return _moving; }
+
+    // True when every joint is on its target
+    bool allAtTarget() const { return _moving == 0; }
+};
+
+#endif
@@ -1,5 +1,5 @@
 #include <knee.h>
 
-Knee::Knee(Servo &servo, uint16_t initialPos)
-  : Joint(servo, initialPos) {
+Knee::Knee(Servo &servo, JointStates &states, AngleQ8 initialPos)
+  : Joint(servo, states, initialPos) {
 }
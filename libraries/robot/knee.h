@@ -8,7 +8,7 @@
  */
 class Knee : public Joint {
   public:
-    Knee(Servo &servo, uint16_t initialPos);
+    Knee(Servo &servo, JointStates &states, AngleQ8 initialPos);
 };
 
 #endif
@@ -1,6 +1,5 @@
 #include <left_front_leg.h>
 
-LeftFrontLeg::LeftFrontLeg(Servo &shoulderServo, Servo &kneeServo,
-                           uint16_t shoulderInitial, uint16_t kneeInitial)
-  : Leg(shoulderServo, kneeServo, shoulderInitial, kneeInitial) {
+LeftFrontLeg::LeftFrontLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle)
+  : Leg(board, frame, states, 0, initialAngle) {  // LF in the topology
 }
@@ -8,8 +8,7 @@
  */
 class LeftFrontLeg : public Leg {
   public:
-    LeftFrontLeg(Servo &shoulderServo, Servo &kneeServo,
-                 uint16_t shoulderInitial, uint16_t kneeInitial);
+    LeftFrontLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle);
 
     const char* getName() const override { return "LeftFront"; }
 };
@@ -1,6 +1,5 @@
 #include <left_middle_leg.h>
 
-LeftMiddleLeg::LeftMiddleLeg(Servo &shoulderServo, Servo &kneeServo,
-                             uint16_t shoulderInitial, uint16_t kneeInitial)
-  : Leg(shoulderServo, kneeServo, shoulderInitial, kneeInitial) {
+LeftMiddleLeg::LeftMiddleLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle)
+  : Leg(board, frame, states, 1, initialAngle) {  // LM in the topology
 }
@@ -8,8 +8,7 @@
  */
 class LeftMiddleLeg : public Leg {
   public:
-    LeftMiddleLeg(Servo &shoulderServo, Servo &kneeServo,
-                  uint16_t shoulderInitial, uint16_t kneeInitial);
+    LeftMiddleLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle);
 
     const char* getName() const override { return "LeftMiddle"; }
 };
@@ -1,6 +1,5 @@
 #include <left_rear_leg.h>
 
-LeftRearLeg::LeftRearLeg(Servo &shoulderServo, Servo &kneeServo,
-                         uint16_t shoulderInitial, uint16_t kneeInitial)
-  : Leg(shoulderServo, kneeServo, shoulderInitial, kneeInitial) {
+LeftRearLeg::LeftRearLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle)
+  : Leg(board, frame, states, 2, initialAngle) {  // LR in the topology
 }
@@ -8,8 +8,7 @@
  */
 class LeftRearLeg : public Leg {
   public:
-    LeftRearLeg(Servo &shoulderServo, Servo &kneeServo,
-                uint16_t shoulderInitial, uint16_t kneeInitial);
+    LeftRearLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle);
 
     const char* getName() const override { return "LeftRear"; }
 };
@@ -1,12 +1,64 @@
 #include <leg.h>
 
-Leg::Leg(Servo &shoulderServo, Servo &kneeServo,
-         float shoulderInitial, float kneeInitial)
-  : _shoulder(shoulderServo, shoulderInitial),
-    _knee(kneeServo, kneeInitial) {
+Leg::Leg(Board& board, ServoFrame& frame, JointStates& states,
+         uint8_t legIndex, AngleQ8 initialAngle)
+  : _index(legIndex),
+    _servos{
+      Servo(board, frame, Topology::servoIndex(legIndex, Topology::SHOULDER)),
+      Servo(board, frame, Topology::servoIndex(legIndex, Topology::KNEE))
+#if ROBOT_LEG_DOF == 3
+      , Servo(board, frame, Topology::servoIndex(legIndex, Topology::TIBIA))
+#endif
+    },
+    _shoulder(_servos[Topology::SHOULDER], states, initialAngle),
+    _knee(_servos[Topology::KNEE], states, initialAngle)
+#if ROBOT_LEG_DOF == 3
+    , _tibia(_servos[Topology::TIBIA], states, initialAngle)
+#endif
+    , _idleMs(0),
+    _released(false)
+{
+  _joints[Topology::SHOULDER] = &_shoulder;
+  _joints[Topology::KNEE] = &_knee;
+#if ROBOT_LEG_DOF == 3
+  _joints[Topology::TIBIA] = &_tibia;
+#endif
 }
 
-void Leg::update(uint32_t deltaMs) {
-  _shoulder.update(deltaMs);
-  _knee.update(deltaMs);
+bool Leg::updateIdle(uint32_t deltaMs, uint32_t timeoutMs) {
+  if (_released || timeoutMs == 0 || !atTarget()) {
+    return false;
+  }
+
+  _idleMs += deltaMs;
+  if (_idleMs < timeoutMs) {
+    return false;
+  }
+
+  for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+    _servos[j].release();
+  }
+  _released = true;
+  return true;
+}
+
+void Leg::engage() {
+  _idleMs = 0;
+  if (!_released) {
+    return;
+  }
+
+  for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+    _servos[j].engage();
+  }
+  _released = false;
+}
+
+bool Leg::atTarget() const {
+  for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+    if (!_joints[j]->atTarget()) {
+      return false;
+    }
+  }
+  return true;
 }
@@ -1,39 +1,85 @@
 #ifndef LEG_H
 #define LEG_H
 
+#include <board.h>
+#include <servo.h>
+#include <servo_frame.h>
+#include <joint_states.h>
+#include <robot_topology.h>
 #include <shoulder.h>
 #include <knee.h>
+#if ROBOT_LEG_DOF == 3
+#include <tibia.h>
+#endif
 
 /*
  * Base class for robot legs.
  *
- * Each leg has a shoulder and knee joint. Named subclasses
- * (LeftFrontLeg, etc.) can override movement methods to
- * provide leg-specific positioning and kinematics.
+ * Each leg owns its servos and joints - a shoulder and knee, plus a tibia
+ * on 3-DOF builds (see robot_topology.h). Servo numbers come from the
+ * leg's position in the topology. Joint motion state lives in Body's
+ * JointStates; the joints here are views onto it. Named subclasses
+ * (LeftFrontLeg, etc.) can override movement methods to provide
+ * leg-specific positioning and kinematics.
  */
 class Leg {
   protected:
+    uint8_t _index;
+
+    // Servos indexed by joint slot - declared before the joints that drive them
+    Servo _servos[Topology::JOINTS_PER_LEG];
+
     Shoulder _shoulder;
     Knee _knee;
+#if ROBOT_LEG_DOF == 3
+    Tibia _tibia;
+#endif
 
-  public:
-    Leg(Servo &shoulderServo, Servo &kneeServo,
-        float shoulderInitial, float kneeInitial);
+    // Joints indexed by slot, for iteration
+    Joint* _joints[Topology::JOINTS_PER_LEG];
+
+    // Idle power saving - time spent at target, and whether servos are off
+    uint32_t _idleMs;
+    bool _released;
 
-    // Update both joints based on elapsed time
-    virtual void update(uint32_t deltaMs);
+  public:
+    Leg(Board& board, ServoFrame& frame, JointStates& states,
+        uint8_t legIndex, AngleQ8 initialAngle);
 
     // Get leg name for debugging/logging
     virtual const char* getName() const = 0;
 
+    // Position in the topology (0-5, LF..RR)
+    uint8_t getIndex() const { return _index; }
+
     // Access to joints
     Shoulder& shoulder() { return _shoulder; }
     Knee& knee() { return _knee; }
     const Shoulder& shoulder() const { return _shoulder; }
     const Knee& knee() const { return _knee; }
+#if ROBOT_LEG_DOF == 3
+    Tibia& tibia() { return _tibia; }
+    const Tibia& tibia() const { return _tibia; }
+#endif
+
+    // Access by joint slot (Topology::SHOULDER, KNEE, TIBIA)
+    Joint& joint(uint8_t slot) { return *_joints[slot]; }
+    const Joint& joint(uint8_t slot) const { return *_joints[slot]; }
+    Servo& servo(uint8_t slot) { return _servos[slot]; }
+
+    // Check if all joints have reached their targets
+    bool atTarget() const;
+
+    // Idle power saving: accumulate time at target and switch the leg's
+    // servos to full-off once timeoutMs is reached. Returns true if the
+    // leg was released by this call.
+    bool updateIdle(uint32_t deltaMs, uint32_t timeoutMs);
+
+    // Re-energize released servos at their last angle and restart the
+    // idle timer (call before the leg moves)
+    void engage();
 
-    // Check if both joints have reached their targets
-    bool atTarget() const { return _shoulder.atTarget() && _knee.atTarget(); }
+    bool isReleased() const { return _released; }
 };
 
 #endif
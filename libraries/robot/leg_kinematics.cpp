@@ -0,0 +1,168 @@
+#include "leg_kinematics.h"
+
+constexpr LegGeometry LegKinematics::SIXPACK;
+
+// Internal lengths are in 1/16 mm
+static const int32_t SUBMM = 16;
+
+static const int32_t DEG_90 = 90 * JointMotion::ONE_DEGREE;
+static const int32_t DEG_180 = 180 * JointMotion::ONE_DEGREE;
+static const int32_t DEG_360 = 360 * JointMotion::ONE_DEGREE;
+
+// atan(i / 256) in Q8.8 degrees, i = 0..256
+static const uint16_t ATAN_TABLE[257] = {
+      0,    57,   115,   172,   229,   286,   344,   401,   458,   515,   573,   630,
+    687,   744,   801,   858,   916,   973,  1030,  1087,  1144,  1201,  1257,  1314,
+   1371,  1428,  1485,  1541,  1598,  1655,  1711,  1768,  1824,  1880,  1937,  1993,
+   2049,  2105,  2161,  2217,  2273,  2329,  2385,  2441,  2497,  2552,  2608,  2663,
+   2719,  2774,  2829,  2884,  2939,  2994,  3049,  3104,  3159,  3213,  3268,  3322,
+   3377,  3431,  3485,  3539,  3593,  3647,  3701,  3755,  3808,  3862,  3915,  3968,
+   4021,  4074,  4127,  4180,  4233,  4286,  4338,  4390,  4443,  4495,  4547,  4599,
+   4650,  4702,  4754,  4805,  4856,  4908,  4959,  5010,  5060,  5111,  5162,  5212,
+   5262,  5313,  5363,  5412,  5462,  5512,  5561,  5611,  5660,  5709,  5758,  5807,
+   5856,  5904,  5953,  6001,  6049,  6097,  6145,  6193,  6240,  6288,  6335,  6382,
+   6429,  6476,  6523,  6570,  6616,  6662,  6709,  6755,  6801,  6846,  6892,  6938,
+   6983,  7028,  7073,  7118,  7163,  7207,  7252,  7296,  7340,  7384,  7428,  7472,
+   7516,  7559,  7602,  7646,  7689,  7731,  7774,  7817,  7859,  7901,  7944,  7986,
+   8027,  8069,  8111,  8152,  8193,  8235,  8275,  8316,  8357,  8398,  8438,  8478,
+   8518,  8558,  8598,  8638,  8677,  8717,  8756,  8795,  8834,  8873,  8912,  8950,
+   8989,  9027,  9065,  9103,  9141,  9179,  9216,  9254,  9291,  9328,  9365,  9402,
+   9439,  9475,  9512,  9548,  9584,  9620,  9656,  9692,  9728,  9763,  9799,  9834,
+   9869,  9904,  9939,  9973, 10008, 10042, 10077, 10111, 10145, 10179, 10213, 10246,
+  10280, 10313, 10347, 10380, 10413, 10446, 10478, 10511, 10544, 10576, 10608, 10640,
+  10672, 10704, 10736, 10768, 10799, 10831, 10862, 10893, 10924, 10955, 10986, 11016,
+  11047, 11077, 11108, 11138, 11168, 11198, 11228, 11258, 11287, 11317, 11346, 11375,
+  11405, 11434, 11462, 11491, 11520,
+};
+
+// sin(d) * 32768 for whole degrees d = 0..90
+static const uint16_t SIN_TABLE[91] = {
+      0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+   5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+  11207, 11743, 12275, 12803, 13328, 13848, 14365, 14876, 15384, 15886,
+  16384, 16877, 17364, 17847, 18324, 18795, 19261, 19720, 20174, 20622,
+  21063, 21498, 21926, 22348, 22763, 23170, 23571, 23965, 24351, 24730,
+  25102, 25466, 25822, 26170, 26510, 26842, 27166, 27482, 27789, 28088,
+  28378, 28660, 28932, 29197, 29452, 29698, 29935, 30163, 30382, 30592,
+  30792, 30983, 31164, 31336, 31499, 31651, 31795, 31928, 32052, 32166,
+  32270, 32365, 32449, 32524, 32588, 32643, 32688, 32723, 32748, 32763,
+  32768,
+};
+
+// Nearest whole millimetre to a length in 1/16 mm
+static int16_t toMm(int32_t length) {
+  return (int16_t)(length >= 0 ? (length + SUBMM / 2) / SUBMM : -((-length + SUBMM / 2) / SUBMM));
+}
+
+// atan of a ratio in [0, 1], Q16
+static int32_t atanRatio(uint32_t ratio) {
+  uint32_t index = ratio >> 8;
+  if (index >= 256) {
+    return ATAN_TABLE[256];
+  }
+  int32_t from = ATAN_TABLE[index];
+  return from + (((int32_t)ATAN_TABLE[index + 1] - from) * (int32_t)(ratio & 0xFF) >> 8);
+}
+
+LegKinematics::LegKinematics(const LegGeometry& geometry)
+  : _geometry(geometry) {
+}
+
+int32_t LegKinematics::atan2Q8(int32_t y, int32_t x) {
+  // First octant from the table, then folded out by the signs and the
+  // larger of |x| and |y| (both well under 2^15 here)
+  uint32_t ax = x < 0 ? -x : x;
+  uint32_t ay = y < 0 ? -y : y;
+  if (ax == 0 && ay == 0) {
+    return 0;
+  }
+  int32_t angle = ay <= ax ? atanRatio((ay << 16) / ax)
+                           : DEG_90 - atanRatio((ax << 16) / ay);
+  if (x < 0) angle = DEG_180 - angle;
+  return y < 0 ? -angle : angle;
+}
+
+int32_t LegKinematics::sinQ15(int32_t angle) {
+  angle %= DEG_360;
+  if (angle < 0) angle += DEG_360;
+
+  int32_t sign = 1;
+  if (angle >= DEG_180) {
+    angle -= DEG_180;
+    sign = -1;
+  }
+  if (angle > DEG_90) {
+    angle = DEG_180 - angle;
+  }
+
+  uint32_t degree = angle >> 8;
+  int32_t value = SIN_TABLE[degree];
+  if (degree < 90) {
+    value += ((int32_t)SIN_TABLE[degree + 1] - value) * (angle & 0xFF) >> 8;
+  }
+  return sign * value;
+}
+
+int32_t LegKinematics::cosQ15(int32_t angle) {
+  return sinQ15(angle + DEG_90);
+}
+
+uint32_t LegKinematics::isqrt(uint32_t value) {
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > value) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+bool LegKinematics::solve(const FootPosition& foot, LegAngles& angles, int16_t* reachY) const {
+  int32_t coxa = _geometry.coxaMm * SUBMM;
+  int32_t femur = _geometry.femurMm * SUBMM;
+  int32_t x = foot.x * SUBMM;
+  int32_t z = foot.z * SUBMM;
+
+  // Knee: the femur drops by beta to reach z, and its horizontal part
+  // adds to the coxa for the reach
+  if (z > femur || z < -femur) {
+    return false;
+  }
+  int32_t across = (int32_t)isqrt((uint32_t)(femur * femur - z * z));
+  int32_t beta = atan2Q8(-z, across);
+  int32_t reach = coxa + across;
+
+  // Shoulder: turn that reach until the foot is x forward
+  if (x > reach || x < -reach) {
+    return false;
+  }
+  int32_t out = (int32_t)isqrt((uint32_t)(reach * reach - x * x));
+
+  angles.shoulder = atan2Q8(x, out);
+  angles.knee = beta - _geometry.kneeRestDeg * JointMotion::ONE_DEGREE;
+  if (reachY != nullptr) {
+    *reachY = toMm(out);
+  }
+  return true;
+}
+
+FootPosition LegKinematics::forward(const LegAngles& angles) const {
+  int32_t coxa = _geometry.coxaMm * SUBMM;
+  int32_t femur = _geometry.femurMm * SUBMM;
+  int32_t beta = _geometry.kneeRestDeg * JointMotion::ONE_DEGREE + angles.knee;
+
+  int32_t reach = coxa + (femur * cosQ15(beta) >> 15);
+  FootPosition foot;
+  foot.x = toMm(reach * sinQ15(angles.shoulder) >> 15);
+  foot.y = toMm(reach * cosQ15(angles.shoulder) >> 15);
+  foot.z = toMm(-(femur * sinQ15(beta)) >> 15);
+  return foot;
+}
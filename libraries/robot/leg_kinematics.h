@@ -0,0 +1,74 @@
+#ifndef LEG_KINEMATICS_H
+#define LEG_KINEMATICS_H
+
+#include <stdint.h>
+#include "joint_motion.h"
+
+// Foot position in millimetres, in the leg's own frame: origin at the
+// shoulder pivot, x forward, y outward from the body, z up
+struct FootPosition {
+  int16_t x;
+  int16_t y;
+  int16_t z;
+};
+
+// Shoulder and knee angles from the servo middle, Q8.8 degrees, written
+// for a left leg (shoulder + = forward, knee + = foot down)
+struct LegAngles {
+  int32_t shoulder;
+  int32_t knee;
+};
+
+// Link lengths of a 2-DOF leg (ADR 002: shoulder swings the leg
+// horizontally, knee tilts the whole leg up and down)
+struct LegGeometry {
+  uint16_t coxaMm;       // Shoulder pivot to knee pivot
+  uint16_t femurMm;      // Knee pivot to foot tip
+  int8_t kneeRestDeg;    // Leg's drop below horizontal with the knee at middle
+};
+
+/*
+ * Inverse and forward kinematics for the shoulder/knee leg.
+ *
+ * The shoulder turns the leg about a vertical axis by theta; the knee,
+ * coxaMm out from it, tilts a rigid femurMm segment down by beta
+ * (kneeRestDeg + knee angle). So for a foot at (x, y, z):
+ *
+ *   reach  R = coxa + femur * cos(beta)      z = -femur * sin(beta)
+ *   x = R * sin(theta)                       y = R * cos(theta)
+ *
+ * Two joints fix two coordinates: solve() takes x and z and returns the
+ * y they put the foot at. Both directions run in integer maths at 1/16 mm
+ * - angles come from an atan table (atan2 by octant) and integer square
+ * roots, sines from a 1° table - so a whole body solves without libm
+ * and well inside a control frame. Right legs are mirrored by the
+ * caller, as with gait tables.
+ */
+class LegKinematics {
+  private:
+    LegGeometry _geometry;
+
+  public:
+    // Nominal SIXpack link lengths - measure the printed legs and pass
+    // their own geometry where millimetres need to be exact
+    static constexpr LegGeometry SIXPACK = { 30, 70, 30 };
+
+    LegKinematics(const LegGeometry& geometry = SIXPACK);
+
+    const LegGeometry& getGeometry() const { return _geometry; }
+
+    // Joint angles that put the foot at foot.x, foot.z. Returns false if
+    // that is out of the leg's reach; reachY gets the foot's y
+    bool solve(const FootPosition& foot, LegAngles& angles, int16_t* reachY = nullptr) const;
+
+    // Foot position for joint angles
+    FootPosition forward(const LegAngles& angles) const;
+
+    // Lookup-table trig, angles in Q8.8 degrees
+    static int32_t atan2Q8(int32_t y, int32_t x);   // -180° to 180°
+    static int32_t sinQ15(int32_t angle);           // sin * 32768
+    static int32_t cosQ15(int32_t angle);           // cos * 32768
+    static uint32_t isqrt(uint32_t value);
+};
+
+#endif
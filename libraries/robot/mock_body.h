@@ -3,56 +3,76 @@
 
 #include <Arduino.h>
 #include <i_gait_target.h>
+#include <board.h>
+#include <joint_motion.h>
+#include <motion_profile.h>
 #include <gait_sequence.h>
+#include <leg_kinematics.h>
+#include <robot_topology.h>
 #include <logging.h>
 
 /**
  * Simulated joint for testing - tracks position without hardware.
+ *
+ * Plans and evaluates moves with the same kernel as Joint
+ * (motion_profile.h, constant speed), so simulated positions are
+ * bit-identical to the robot's and can be read at any timestamp.
  */
 class MockJoint {
   private:
     const char* _name;
-    float _currentPos;
-    float _targetPos;
-    float _speed;
+    AngleQ8 _currentPos;
+    MotionPlan _plan;
+    uint32_t _startMs;
+    uint32_t _nowMs;
 
   public:
-    MockJoint(const char* name, float initialPos = 90.0f)
+    MockJoint(const char* name, AngleQ8 initialPos = JointMotion::degrees(90))
       : _name(name),
         _currentPos(initialPos),
-        _targetPos(initialPos),
-        _speed(180.0f) {}
+        _startMs(0),
+        _nowMs(0) {
+      reset(initialPos);
+    }
 
-    void setTarget(float target, float speed) {
-      _targetPos = target;
-      _speed = speed;
+    void setTarget(AngleQ8 target, SpeedQ16 speed) {
+      _plan = MotionProfile::plan(ProfileType::CONSTANT, _currentPos, target, speed, { 0, 0 });
+      _startMs = _nowMs;
     }
 
-    void update(uint32_t deltaMs) {
-      if (atTarget()) return;
+    void setTargetTimed(AngleQ8 target, uint32_t durationMs) {
+      _plan = MotionProfile::planTimed(ProfileType::CONSTANT, _currentPos, target, durationMs, { 0, 0 });
+      _startMs = _nowMs;
+    }
 
-      float maxDelta = (_speed * deltaMs) / 1000.0f;
-      float direction = (_currentPos < _targetPos) ? 1.0f : -1.0f;
-      float distance = abs(_targetPos - _currentPos);
+    // Returns true if the joint arrived at its target during this update
+    bool update(uint32_t deltaMs) {
+      return advanceTo(_nowMs + deltaMs);
+    }
 
-      if (maxDelta >= distance) {
-        _currentPos = _targetPos;
-      } else {
-        _currentPos += direction * maxDelta;
+    // Jump straight to simulated time nowMs
+    // Returns true if the joint arrived at its target on the way
+    bool advanceTo(uint32_t nowMs) {
+      _nowMs = nowMs;
+      if (atTarget()) {
+        return false;
       }
+      _currentPos = MotionProfile::evaluate(_plan, nowMs - _startMs);
+      return atTarget();
     }
 
     bool atTarget() const {
-      return abs(_currentPos - _targetPos) < 0.5f;
+      return _currentPos == _plan.target;
     }
 
-    float getPosition() const { return _currentPos; }
-    float getTarget() const { return _targetPos; }
+    AngleQ8 getPosition() const { return _currentPos; }
+    AngleQ8 getTarget() const { return _plan.target; }
     const char* getName() const { return _name; }
 
-    void reset(float pos = 90.0f) {
+    void reset(AngleQ8 pos = JointMotion::degrees(90)) {
       _currentPos = pos;
-      _targetPos = pos;
+      _plan = MotionProfile::plan(ProfileType::CONSTANT, pos, pos, 0, { 0, 0 });
+      _startMs = _nowMs;
     }
 };
 
@@ -74,9 +94,9 @@ class MockLeg {
     const MockJoint& shoulder() const { return _shoulder; }
     const MockJoint& knee() const { return _knee; }
 
-    void update(uint32_t deltaMs) {
-      _shoulder.update(deltaMs);
-      _knee.update(deltaMs);
+    // Returns the number of joints that arrived on the way to nowMs
+    uint8_t advanceTo(uint32_t nowMs) {
+      return _shoulder.advanceTo(nowMs) + _knee.advanceTo(nowMs);
     }
 
     bool atTarget() const {
@@ -94,6 +114,8 @@ class MockLeg {
  *
  * Simulates 6 legs with 2 joints each, tracking positions in software.
  * No servo writes occur - just state tracking and logging.
+ * Like Body, it counts joints still moving so atTarget() is constant
+ * time, and reports each completed step through onMotionComplete().
  */
 class MockBody : public IGaitTarget {
   private:
@@ -104,18 +126,17 @@ class MockBody : public IGaitTarget {
     MockLeg _rightMiddle;
     MockLeg _rightRear;
 
-    // Default speed for movements (degrees per second)
-    static constexpr float DEFAULT_SPEED = 180.0f;
+    // Safe angle limits and default speed come from the same Board the
+    // robot uses, so gait deltas resolve to the same targets
+    Board _board;
+    LegKinematics _kinematics;
 
-    // Safe angle limits
-    static constexpr float SAFE_MIN = 2.0f;
-    static constexpr float SAFE_MAX = 178.0f;
-
-    float clamp(float value, float minVal, float maxVal) const {
-      if (value < minVal) return minVal;
-      if (value > maxVal) return maxVal;
-      return value;
-    }
+    // Joints away from their target, and whether the targets applied
+    // since the last completion have been reported yet
+    uint32_t _nowMs;  // Simulated time
+    uint8_t _moving;
+    bool _motionPending;
+    MotionCompleteCallback _motionCompleteCallback;
 
   public:
     MockBody()
@@ -124,7 +145,11 @@ class MockBody : public IGaitTarget {
         _leftRear("LR.shoulder", "LR.knee"),
         _rightFront("RF.shoulder", "RF.knee"),
         _rightMiddle("RM.shoulder", "RM.knee"),
-        _rightRear("RR.shoulder", "RR.knee") {}
+        _rightRear("RR.shoulder", "RR.knee"),
+        _nowMs(0),
+        _moving(0),
+        _motionPending(false),
+        _motionCompleteCallback(nullptr) {}
 
     // Note: applyGait cannot be used with GaitSequence directly because
     // GaitSequence uses specific leg types. Use applyStep() instead.
@@ -164,21 +189,37 @@ class MockBody : public IGaitTarget {
     }
 
     void update(uint32_t deltaMs) override {
-      _leftFront.update(deltaMs);
-      _leftMiddle.update(deltaMs);
-      _leftRear.update(deltaMs);
-      _rightFront.update(deltaMs);
-      _rightMiddle.update(deltaMs);
-      _rightRear.update(deltaMs);
+      advanceTo(_nowMs + deltaMs);
+    }
+
+    // Jump the simulation straight to nowMs - positions are the same as
+    // if it had been updated tick by tick
+    void advanceTo(uint32_t nowMs) {
+      _nowMs = nowMs;
+      _moving -= _leftFront.advanceTo(nowMs);
+      _moving -= _leftMiddle.advanceTo(nowMs);
+      _moving -= _leftRear.advanceTo(nowMs);
+      _moving -= _rightFront.advanceTo(nowMs);
+      _moving -= _rightMiddle.advanceTo(nowMs);
+      _moving -= _rightRear.advanceTo(nowMs);
+
+      // Same completion rule as Body::update()
+      if (_motionPending && _moving == 0) {
+        _motionPending = false;
+        if (_motionCompleteCallback) {
+          _motionCompleteCallback();
+        }
+      }
     }
 
     bool atTarget() const override {
-      return _leftFront.atTarget() &&
-             _leftMiddle.atTarget() &&
-             _leftRear.atTarget() &&
-             _rightFront.atTarget() &&
-             _rightMiddle.atTarget() &&
-             _rightRear.atTarget();
+      return _moving == 0;
+    }
+
+    uint32_t getTime() const { return _nowMs; }
+
+    void onMotionComplete(MotionCompleteCallback callback) override {
+      _motionCompleteCallback = callback;
     }
 
     void resetToMiddle() override {
@@ -188,9 +229,41 @@ class MockBody : public IGaitTarget {
       _rightFront.reset();
       _rightMiddle.reset();
       _rightRear.reset();
+      _moving = 0;
+      _motionPending = true;
       Log::println("MockBody: Reset to middle (90 degrees)");
     }
 
+    // Same solve, mirroring and range check as Body::setFootTarget()
+    bool setFootTarget(uint8_t leg, const FootPosition& foot, uint32_t durationMs) override {
+      LegAngles angles;
+      if (!_kinematics.solve(foot, angles)) {
+        return false;
+      }
+
+      int32_t sign = leg >= Topology::LEG_COUNT / 2 ? -1 : 1;
+      int32_t shoulder = (int32_t)_board.servoMiddle() + sign * angles.shoulder;
+      int32_t knee = (int32_t)_board.servoMiddle() + sign * angles.knee;
+      if (shoulder < _board.servoSafeMin() || shoulder > _board.servoSafeMax() ||
+          knee < _board.servoSafeMin() || knee > _board.servoSafeMax()) {
+        return false;
+      }
+
+      _motionPending = true;
+      moveTimed(legAt(leg).shoulder(), (AngleQ8)shoulder, durationMs);
+      moveTimed(legAt(leg).knee(), (AngleQ8)knee, durationMs);
+      return true;
+    }
+
+    FootPosition getFootPosition(uint8_t leg) const override {
+      const MockLeg& at = legAt(leg);
+      int32_t sign = leg >= Topology::LEG_COUNT / 2 ? -1 : 1;
+      LegAngles angles;
+      angles.shoulder = sign * ((int32_t)at.shoulder().getPosition() - _board.servoMiddle());
+      angles.knee = sign * ((int32_t)at.knee().getPosition() - _board.servoMiddle());
+      return _kinematics.forward(angles);
+    }
+
     void logState() const override {
       Log::println("MockBody State:");
       logLeg("  LF", _leftFront);
@@ -202,23 +275,57 @@ class MockBody : public IGaitTarget {
     }
 
   private:
+    // Legs by index, LF..RR
+    MockLeg& legAt(uint8_t leg) {
+      MockLeg* legs[Topology::LEG_COUNT] = {
+        &_leftFront, &_leftMiddle, &_leftRear, &_rightFront, &_rightMiddle, &_rightRear
+      };
+      return *legs[leg];
+    }
+
+    const MockLeg& legAt(uint8_t leg) const {
+      const MockLeg* legs[Topology::LEG_COUNT] = {
+        &_leftFront, &_leftMiddle, &_leftRear, &_rightFront, &_rightMiddle, &_rightRear
+      };
+      return *legs[leg];
+    }
+
+    // Keep the moving count right after a joint's target changed
+    void track(MockJoint& joint, bool wasMoving) {
+      bool nowMoving = !joint.atTarget();
+      if (nowMoving && !wasMoving) {
+        _moving++;
+      } else if (wasMoving && !nowMoving) {
+        _moving--;
+      }
+    }
+
+    void moveTimed(MockJoint& joint, AngleQ8 target, uint32_t durationMs) {
+      bool wasMoving = !joint.atTarget();
+      joint.setTargetTimed(target, durationMs);
+      track(joint, wasMoving);
+    }
+
     void applyDelta(MockJoint& joint, int8_t delta) {
+      _motionPending = true;
       if (delta == 0) return;
 
-      float currentPos = joint.getPosition();
-      float newTarget = currentPos + (float)delta;
-      newTarget = clamp(newTarget, SAFE_MIN, SAFE_MAX);
-
-      joint.setTarget(newTarget, DEFAULT_SPEED);
+      // Same fixed-point math as MultiStepGait::applyDelta()
+      AngleQ8 newTarget = JointMotion::offset(joint.getTarget(), delta,
+                                              _board.servoSafeMin(), _board.servoSafeMax());
+      AngleQ8 distance = JointMotion::degrees(delta < 0 ? -delta : delta);
+      bool wasMoving = !joint.atTarget();
+      joint.setTarget(newTarget, _board.servoSpeed(0, distance));
+      track(joint, wasMoving);
     }
 
     void logLeg(const char* prefix, const MockLeg& leg) const {
       Log::println("%s: sh=%.1f->%.1f kn=%.1f->%.1f %s",
                    prefix,
-                   leg.shoulder().getPosition(),
-                   leg.shoulder().getTarget(),
-                   leg.knee().getPosition(),
-                   leg.knee().getTarget(),
+                   JointMotion::toDegrees(leg.shoulder().getPosition()),
+                   JointMotion::toDegrees(leg.shoulder().getTarget()),
+                   JointMotion::toDegrees(leg.knee().getPosition()),
+                   JointMotion::toDegrees(leg.knee().getTarget()),
                    leg.atTarget() ? "[at target]" : "[moving]");
     }
 };
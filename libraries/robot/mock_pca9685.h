@@ -0,0 +1,211 @@
+#ifndef MOCK_PCA9685_H
+#define MOCK_PCA9685_H
+
+#include <stdint.h>
+#include <i_i2c_bus.h>
+#include <pca9685.h>
+#include <robot_topology.h>
+
+/**
+ * Simulated PCA9685 on a simulated I2C bus - for testing without hardware.
+ *
+ * Keeps the chip's 256-byte register file (honouring MODE1 auto-increment)
+ * and counts every transaction and byte that would cross the bus, so the
+ * cost of different output strategies can be compared on the host.
+ *
+ * Byte accounting follows the wire: one address byte per transaction
+ * (plus one for the repeated start of a read) and every data byte.
+ */
+class MockPca9685 : public II2cBus {
+  private:
+    uint8_t _address;
+    uint8_t _registers[256];
+    uint32_t _transactions;
+    uint32_t _bytes;
+
+    // Clock simulation: above _maxReliableHz (or at _glitchHz) reads
+    // come back corrupted
+    uint32_t _clockHz;
+    uint32_t _maxReliableHz;
+    uint32_t _glitchHz;
+
+    bool autoIncrement() const {
+      return (_registers[Pca9685::REG_MODE1] & Pca9685::MODE1_AI) != 0;
+    }
+
+  public:
+    MockPca9685(uint8_t address = PCA9685_DEFAULT_ADDRESS)
+      : _address(address),
+        _transactions(0),
+        _bytes(0),
+        _clockHz(100000),
+        _maxReliableHz(0xFFFFFFFF),
+        _glitchHz(0) {
+      for (int i = 0; i < 256; i++) {
+        _registers[i] = 0;
+      }
+      _registers[Pca9685::REG_MODE1] = Pca9685::MODE1_SLEEP;  // Power-on default
+      _registers[Pca9685::REG_SUBADR1] = 0xE2;
+    }
+
+    bool write(uint8_t address, const uint8_t* data, uint8_t length) override {
+      _transactions++;
+      _bytes += 1 + length;
+      if (address != _address || length == 0) {
+        return false;  // NACK
+      }
+
+      uint8_t reg = data[0];
+      for (uint8_t i = 1; i < length; i++) {
+        _registers[reg] = data[i];
+        if (autoIncrement()) {
+          reg++;
+        }
+      }
+      return true;
+    }
+
+    bool read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) override {
+      _transactions++;
+      _bytes += 3 + length;  // address(W), register, address(R), data
+      if (address != _address) {
+        return false;  // NACK
+      }
+
+      bool corrupt = _clockHz > _maxReliableHz || _clockHz == _glitchHz;
+      for (uint8_t i = 0; i < length; i++) {
+        data[i] = corrupt ? (uint8_t)(_registers[reg] ^ 0x04) : _registers[reg];
+        if (autoIncrement()) {
+          reg++;
+        }
+      }
+      return true;
+    }
+
+    bool setClock(uint32_t hz) override {
+      _clockHz = hz;
+      return true;
+    }
+
+    // Simulate wiring that only works up to a given clock rate
+    void setMaxReliableClock(uint32_t hz) { _maxReliableHz = hz; }
+
+    // Simulate noise that corrupts reads at one clock rate only
+    void setGlitchClock(uint32_t hz) { _glitchHz = hz; }
+    uint32_t getClock() const { return _clockHz; }
+
+    // 13-bit OFF value of a channel (bit 12 = full off)
+    uint16_t channelOff(uint8_t channel) const {
+      uint8_t reg = Pca9685::REG_LED0_ON_L + channel * Pca9685::BYTES_PER_CHANNEL;
+      return _registers[reg + 2] | ((_registers[reg + 3] & 0x1F) << 8);
+    }
+
+    uint8_t getRegister(uint8_t reg) const { return _registers[reg]; }
+
+    // Bus statistics
+    uint32_t getTransactionCount() const { return _transactions; }
+    uint32_t getByteCount() const { return _bytes; }
+    void resetCounts() {
+      _transactions = 0;
+      _bytes = 0;
+    }
+};
+
+/**
+ * Every PCA9685 in the topology, each simulated on its own bus.
+ *
+ * drivers() is the Topology::DRIVER_COUNT array ServoFrame::flush()
+ * takes, so frame tests run unchanged with one or two boards. The set is
+ * also an II2cBus that routes each transaction to the board at its
+ * address, as the shared bus on the robot does.
+ */
+class MockPca9685Boards : public II2cBus {
+  private:
+    MockPca9685 _buses[Topology::DRIVER_COUNT];
+    Pca9685 _drivers[Topology::DRIVER_COUNT];
+
+    MockPca9685* at(uint8_t address) {
+      for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+        if (Topology::DRIVER_ADDRESSES[d] == address) {
+          return &_buses[d];
+        }
+      }
+      return nullptr;
+    }
+
+  public:
+    MockPca9685Boards()
+      : _buses{
+          MockPca9685(Topology::DRIVER_ADDRESSES[0])
+#if ROBOT_PWM_DRIVERS == 2
+          , MockPca9685(Topology::DRIVER_ADDRESSES[1])
+#endif
+        },
+        _drivers{
+          Pca9685(_buses[0], Topology::DRIVER_ADDRESSES[0])
+#if ROBOT_PWM_DRIVERS == 2
+          , Pca9685(_buses[1], Topology::DRIVER_ADDRESSES[1])
+#endif
+        } {}
+
+    bool begin() {
+      bool ok = true;
+      for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+        ok = _drivers[d].begin() && ok;
+      }
+      return ok;
+    }
+
+    // Shared bus: transactions reach the board at that address (NACK if
+    // none), the clock reaches every board
+    bool write(uint8_t address, const uint8_t* data, uint8_t length) override {
+      MockPca9685* board = at(address);
+      return board != nullptr && board->write(address, data, length);
+    }
+
+    bool read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) override {
+      MockPca9685* board = at(address);
+      return board != nullptr && board->read(address, reg, data, length);
+    }
+
+    bool setClock(uint32_t hz) override {
+      for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+        _buses[d].setClock(hz);
+      }
+      return true;
+    }
+
+    Pca9685* drivers() { return _drivers; }
+    MockPca9685& bus(uint8_t driver) { return _buses[driver]; }
+
+    // OFF value on the board and channel a servo is wired to
+    uint16_t servoOff(uint8_t servo) const {
+      Topology::ServoChannel at = Topology::channelOf(servo);
+      return _buses[at.driver].channelOff(at.channel);
+    }
+
+    // Totals over all buses
+    uint32_t getTransactionCount() const {
+      uint32_t count = 0;
+      for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+        count += _buses[d].getTransactionCount();
+      }
+      return count;
+    }
+
+    uint32_t getByteCount() const {
+      uint32_t count = 0;
+      for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+        count += _buses[d].getByteCount();
+      }
+      return count;
+    }
+
+    void resetCounts() {
+      for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+        _buses[d].resetCounts();
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,201 @@
+#include <motion_profile.h>
+
+namespace MotionProfile {
+
+  const char* name(ProfileType type) {
+    switch (type) {
+      case ProfileType::TRAPEZOID: return "trapezoid";
+      case ProfileType::SCURVE: return "scurve";
+      default: return "constant";
+    }
+  }
+
+  static uint32_t toMs(uint64_t ms) {
+    if (ms < 1) return 1;
+    if (ms > 4000000000u) return 4000000000u;
+    return (uint32_t)ms;
+  }
+
+  // Integer roots, rounded down - the same result on every target,
+  // where sqrtf/cbrtf may differ in the last bit
+  static uint64_t isqrt(uint64_t value) {
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) {
+      bit >>= 2;
+    }
+    while (bit != 0) {
+      if (value >= root + bit) {
+        value -= root + bit;
+        root = (root >> 1) + bit;
+      } else {
+        root >>= 1;
+      }
+      bit >>= 2;
+    }
+    return root;
+  }
+
+  static uint64_t icbrt(uint64_t value) {
+    uint64_t low = 0;
+    uint64_t high = 2642245;  // Cube root of 2^64, rounded down
+    while (low < high) {
+      uint64_t mid = (low + high + 1) / 2;
+      if (mid * mid * mid <= value) {
+        low = mid;
+      } else {
+        high = mid - 1;
+      }
+    }
+    return low;
+  }
+
+  // Roots rounded up, for durations that must not fall short of a limit
+  static uint64_t isqrtCeil(uint64_t value) {
+    uint64_t root = isqrt(value);
+    return root * root < value ? root + 1 : root;
+  }
+
+  static uint64_t icbrtCeil(uint64_t value) {
+    uint64_t root = icbrt(value);
+    return root * root * root < value ? root + 1 : root;
+  }
+
+  static uint64_t divCeil(uint64_t a, uint64_t b) {
+    return (a + b - 1) / b;
+  }
+
+  // A plan that has not been timed yet (durationMs of 0 arrives at once)
+  static MotionPlan begin(ProfileType type, AngleQ8 start, AngleQ8 target,
+                          const MotionLimits& limits) {
+    MotionPlan p;
+    p.start = start;
+    p.target = target;
+    p.durationMs = 0;
+    p.rampMs = 0;
+    p.k0 = 0;
+    p.k1 = 0;
+    p.type = limits.accel == 0 ? ProfileType::CONSTANT : type;  // No limits to plan with
+    return p;
+  }
+
+  // Fill in the evaluation scales once durationMs (and rampMs) are known
+  static void scale(MotionPlan& p, uint32_t d) {
+    if (p.type == ProfileType::CONSTANT) {
+      p.k0 = ((uint64_t)d << 32) / p.durationMs;
+    } else if (p.type == ProfileType::SCURVE) {
+      p.k0 = (1ULL << 48) / p.durationMs;         // 1/T, so t * k0 >> 32 is Q16
+    } else {
+      // Rounded to whole ms, the ramps and cruise are rescaled to cover d exactly:
+      // s = d t^2 / (2 ramp (T - ramp)) while accelerating,
+      // s = d (2t - ramp) / (2 (T - ramp)) while cruising
+      uint64_t cruise = p.durationMs - p.rampMs;
+      p.k0 = ((uint64_t)d << 32) / (2 * (uint64_t)p.rampMs * cruise);
+      p.k1 = ((uint64_t)d << 32) / (2 * cruise);
+    }
+  }
+
+  MotionPlan plan(ProfileType type, AngleQ8 start, AngleQ8 target,
+                  SpeedQ16 peak, const MotionLimits& limits) {
+    MotionPlan p = begin(type, start, target, limits);
+
+    if (peak == 0) {
+      peak = 1;  // Slowest representable speed rather than never arriving
+    }
+    uint32_t d = JointMotion::distance(start, target);
+    if (d == 0) {
+      return p;  // Already there - durationMs of 0 arrives at once
+    }
+
+    if (p.type == ProfileType::CONSTANT) {
+      // d / (peak >> 8) ms, to the nearest ms
+      p.durationMs = (uint32_t)((((uint64_t)d << 8) + peak / 2) / peak);
+      if (p.durationMs == 0) {
+        p.durationMs = 1;
+      }
+      scale(p, d);
+      return p;
+    }
+
+    // Work in Q8.8 counts and milliseconds: v = peak / 256 counts/ms,
+    // a = accel * 256 / 10^6 counts/ms^2, j = jerk * 256 / 10^9 counts/ms^3
+    uint64_t dist = d;
+    uint64_t accel = limits.accel;
+
+    if (p.type == ProfileType::SCURVE) {
+      // Peak speed, acceleration and jerk of the quintic over duration T
+      // are 1.875 d/T, 5.7735 d/T^2 and 60 d/T^3 - take the slowest, each
+      // rounded up to a whole ms
+      uint64_t t = divCeil(480 * dist, peak);                       // 1.875 d / v
+      uint64_t ta = isqrtCeil(divCeil(5773500 * dist, 256 * accel));  // sqrt(5.7735 d / a)
+      if (ta > t) t = ta;
+      if (limits.jerk > 0) {
+        uint64_t tj = icbrtCeil(divCeil(234375000 * dist, limits.jerk));  // cbrt(60 d / j)
+        if (tj > t) t = tj;
+      }
+      p.durationMs = toMs(t);
+      scale(p, d);
+      return p;
+    }
+
+    // Trapezoid - reaching peak speed takes v / a, covering d at it d / v
+    // (both Q16 ms)
+    uint64_t rampQ16 = (uint64_t)peak * 1000000 / accel;
+    uint64_t cruiseQ16 = (dist << 24) / peak;
+    uint64_t total;
+    if (cruiseQ16 <= rampQ16) {
+      // Triangle - peak speed is not reached before braking, so each half
+      // takes sqrt(d / a). Rounded as floor(sqrt(4x) + 1) / 2
+      p.rampMs = toMs((isqrt(dist * 15625 / accel) + 1) / 2);
+      total = (isqrt(dist * 62500 / accel) + 1) / 2;
+    } else {
+      // d / v at peak speed plus one ramp's worth of acceleration
+      p.rampMs = toMs((rampQ16 + 0x8000) >> 16);
+      total = (cruiseQ16 + rampQ16 + 0x8000) >> 16;
+    }
+    p.durationMs = toMs(total);
+    if (p.durationMs < 2 * p.rampMs) {
+      p.durationMs = 2 * p.rampMs;
+    }
+    scale(p, d);
+    return p;
+  }
+
+  MotionPlan planTimed(ProfileType type, AngleQ8 start, AngleQ8 target,
+                       uint32_t durationMs, const MotionLimits& limits) {
+    MotionPlan p = begin(type, start, target, limits);
+
+    uint32_t d = JointMotion::distance(start, target);
+    if (d == 0) {
+      return p;
+    }
+    p.durationMs = durationMs > 0 ? durationMs : 1;
+
+    if (p.type == ProfileType::TRAPEZOID) {
+      // Ramp at the acceleration limit for as long as it takes to cover d in
+      // T: a ramp (T - ramp) = d, so ramp = (T - sqrt(T^2 - 4d/a)) / 2,
+      // evaluated as (4d/a) / (2 (T + sqrt(T^2 - 4d/a))) to keep precision.
+      // A T too short for the limit gets a triangle
+      uint64_t t = p.durationMs;
+      uint64_t fourDA = divCeil((uint64_t)d * 15625, limits.accel);  // 4d/a in ms^2
+      uint64_t ramp;
+      if (t * t > fourDA) {
+        uint64_t fourDAQ8 = ((uint64_t)d * 15625 << 8) / limits.accel;
+        ramp = (fourDAQ8 / (2 * (t + isqrt(t * t - fourDA))) + 0x80) >> 8;
+      } else {
+        ramp = t / 2;
+      }
+      p.rampMs = toMs(ramp);
+      if (2 * p.rampMs > p.durationMs) {
+        p.rampMs = p.durationMs / 2;
+      }
+      if (p.rampMs == 0) {
+        p.type = ProfileType::CONSTANT;  // A 1 ms move has nothing to ramp
+      }
+    }
+
+    scale(p, d);
+    return p;
+  }
+
+}
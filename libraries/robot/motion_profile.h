@@ -0,0 +1,105 @@
+#ifndef MOTION_PROFILE_H
+#define MOTION_PROFILE_H
+
+#include <stdint.h>
+#include <joint_motion.h>
+
+/*
+ * Time-parameterized joint moves.
+ *
+ * Every move is planned once, when the target is set, as a start angle,
+ * a duration and a velocity profile. Position is then a closed-form
+ * function of the time since the move started - it does not depend on
+ * how that time was sliced into ticks, arrives exactly on the target at
+ * exactly durationMs, and can be evaluated at any timestamp.
+ *
+ * - CONSTANT moves at peak speed throughout, with an instant start and stop
+ * - TRAPEZOID ramps up at the acceleration limit, cruises at peak speed
+ *   and ramps down again (a triangle when the move is too short to cruise)
+ * - SCURVE follows the minimum-jerk quintic 10u^3 - 15u^4 + 6u^5, stretched
+ *   until its peak speed, acceleration and jerk are all within limits, so
+ *   acceleration itself starts and ends at zero
+ *
+ * A new target mid-move is planned from rest at the current position.
+ * Planning happens per target and evaluation per tick, both in integers,
+ * so host simulation and the ESP32 time every move to the same ms.
+ */
+enum class ProfileType : uint8_t {
+  CONSTANT,
+  TRAPEZOID,
+  SCURVE
+};
+
+// Acceleration and jerk limits for the accelerated profiles
+struct MotionLimits {
+  uint32_t accel;  // degrees per second^2
+  uint32_t jerk;   // degrees per second^3 (SCURVE only)
+};
+
+// A planned move from start to target
+struct MotionPlan {
+  AngleQ8 start;
+  AngleQ8 target;
+  uint32_t durationMs;  // Time to arrive
+  uint32_t rampMs;      // TRAPEZOID: time spent accelerating (and braking)
+  uint64_t k0;          // Q32 - CONSTANT: speed, TRAPEZOID: ramp scale, SCURVE: 1 / duration
+  uint64_t k1;          // Q32 - TRAPEZOID: cruise scale
+  ProfileType type;
+};
+
+namespace MotionProfile {
+
+  const char* name(ProfileType type);
+
+  // Plan a move from rest at start to target with peak speed and limits.
+  // An accel limit of 0 falls back to CONSTANT
+  MotionPlan plan(ProfileType type, AngleQ8 start, AngleQ8 target,
+                  SpeedQ16 peak, const MotionLimits& limits);
+
+  // Plan the same move to take exactly durationMs - for moves that must
+  // arrive together. durationMs should be at least plan()'s duration for
+  // the joint's peak speed, or its limits will be exceeded
+  MotionPlan planTimed(ProfileType type, AngleQ8 start, AngleQ8 target,
+                       uint32_t durationMs, const MotionLimits& limits);
+
+  // Position elapsedMs into the move - exactly the target once it is over
+  inline AngleQ8 evaluate(const MotionPlan& plan, uint32_t elapsedMs) {
+    if (elapsedMs >= plan.durationMs) {
+      return plan.target;
+    }
+
+    uint64_t d = JointMotion::distance(plan.start, plan.target);
+    uint64_t t = elapsedMs;
+    uint64_t s;  // Q8.8 degrees covered
+    const uint64_t half = 1ULL << 31;  // Round to nearest
+
+    if (plan.type == ProfileType::CONSTANT) {
+      s = (plan.k0 * t + half) >> 32;
+    } else if (plan.type == ProfileType::SCURVE) {
+      // u in Q16 (0..1), then d * (10u^3 - 15u^4 + 6u^5)
+      int64_t u = (int64_t)((t * plan.k0) >> 32);
+      int64_t u2 = (u * u) >> 16;
+      int64_t u3 = (u2 * u) >> 16;
+      int64_t shape = (u3 * (10 * 65536 - 15 * u + 6 * u2)) >> 16;
+      s = (d * (uint64_t)shape) >> 16;
+    } else {
+      uint64_t ramp = plan.rampMs;
+      uint64_t remaining = plan.durationMs - t;
+      if (t < ramp) {
+        s = (plan.k0 * t * t + half) >> 32;                   // Accelerating
+      } else if (remaining > ramp) {
+        s = (plan.k1 * (2 * t - ramp) + half) >> 32;          // Cruising
+      } else {
+        s = d - ((plan.k0 * remaining * remaining + half) >> 32);  // Braking
+      }
+    }
+
+    if (s > d) {
+      s = d;
+    }
+    return plan.target > plan.start ? plan.start + (AngleQ8)s : plan.start - (AngleQ8)s;
+  }
+
+}
+
+#endif
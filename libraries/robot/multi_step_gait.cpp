@@ -1,40 +1,56 @@
 #include "multi_step_gait.h"
+#include "gait_compiler.h"
+#include "gait_format.h"
 #include <Arduino.h>
 
 MultiStepGait::MultiStepGait(const GaitSequenceData* data)
+  : MultiStepGait(data, nullptr) {
+}
+
+MultiStepGait::MultiStepGait(const GaitSequenceData* data, const GaitCompiler::CompiledStep* compiledSteps)
   : _sequenceData(data),
+    _compiledSteps(compiledSteps),
     _currentStepIndex(0),
     _stepInProgress(false),
+    _cycles(data->looping ? 0 : 1),
+    _cycle(0),
     _applyProfiler("GaitApply", false, 1000) {  // Disabled by default, log every 1s
+  loadStep();
+}
+
+void MultiStepGait::loadStep() {
+  if (_sequenceData->steps == nullptr && _sequenceData->blob != nullptr) {
+    GaitFormat::step(_sequenceData->blob, _currentStepIndex, _blobStep);
+  }
 }
 
 void MultiStepGait::applyTo(LeftFrontLeg& leg) {
-  const GaitStep& step = _sequenceData->steps[_currentStepIndex];
+  const GaitStep& step = currentStep();
   applyLegMovement(leg, step.leftFront);
 }
 
 void MultiStepGait::applyTo(LeftMiddleLeg& leg) {
-  const GaitStep& step = _sequenceData->steps[_currentStepIndex];
+  const GaitStep& step = currentStep();
   applyLegMovement(leg, step.leftMiddle);
 }
 
 void MultiStepGait::applyTo(LeftRearLeg& leg) {
-  const GaitStep& step = _sequenceData->steps[_currentStepIndex];
+  const GaitStep& step = currentStep();
   applyLegMovement(leg, step.leftRear);
 }
 
 void MultiStepGait::applyTo(RightFrontLeg& leg) {
-  const GaitStep& step = _sequenceData->steps[_currentStepIndex];
+  const GaitStep& step = currentStep();
   applyLegMovement(leg, step.rightFront);
 }
 
 void MultiStepGait::applyTo(RightMiddleLeg& leg) {
-  const GaitStep& step = _sequenceData->steps[_currentStepIndex];
+  const GaitStep& step = currentStep();
   applyLegMovement(leg, step.rightMiddle);
 }
 
 void MultiStepGait::applyTo(RightRearLeg& leg) {
-  const GaitStep& step = _sequenceData->steps[_currentStepIndex];
+  const GaitStep& step = currentStep();
   applyLegMovement(leg, step.rightRear);
 }
 
@@ -43,7 +59,21 @@ const char* MultiStepGait::getName() const {
 }
 
 const char* MultiStepGait::getStepName() const {
-  return _sequenceData->steps[_currentStepIndex].name;
+  return currentStep().name;
+}
+
+bool MultiStepGait::applyCompiled(JointStates& states) {
+  if (_compiledSteps == nullptr) {
+    return false;
+  }
+  _applyProfiler.tick();
+
+  const GaitCompiler::CompiledStep& step = _compiledSteps[_currentStepIndex];
+  if (step.activeMask != 0) {
+    _stepInProgress = true;
+  }
+  states.applyStep(step.activeMask, step.target, step.speed);
+  return true;
 }
 
 void MultiStepGait::applyLegMovement(Leg& leg, const LegMovement& movement) {
@@ -53,6 +83,11 @@ void MultiStepGait::applyLegMovement(Leg& leg, const LegMovement& movement) {
   if (movement.shoulderDelta != 0 || movement.kneeDelta != 0) {
     _stepInProgress = true;
   }
+#if ROBOT_LEG_DOF == 3
+  if (movement.tibiaDelta != 0) {
+    _stepInProgress = true;
+  }
+#endif
 
   if (movement.shoulderDelta != 0) {
     applyDelta(leg.shoulder(), movement.shoulderDelta, movement.duration);
@@ -60,30 +95,34 @@ void MultiStepGait::applyLegMovement(Leg& leg, const LegMovement& movement) {
   if (movement.kneeDelta != 0) {
     applyDelta(leg.knee(), movement.kneeDelta, movement.duration);
   }
+#if ROBOT_LEG_DOF == 3
+  if (movement.tibiaDelta != 0) {
+    applyDelta(leg.tibia(), movement.tibiaDelta, movement.duration);
+  }
+#endif
 }
 
 void MultiStepGait::applyDelta(Joint& joint, int8_t delta, uint16_t duration) {
-  // Calculate new target as current angle + delta
-  float currentPos = joint.getPosition();
-  float newTarget = currentPos + (float)delta;
-
-  // Clamp to safe angle range
-  const float safeMin = _board.servoSafeMin();  // 2.0 degrees
-  const float safeMax = _board.servoSafeMax();  // 178.0 degrees
-  newTarget = constrain(newTarget, safeMin, safeMax);
+  // New target is the previous target + delta, clamped to the safe angle
+  // range (2.0 - 178.0 degrees) - same math MockBody uses on the host.
+  // Building on the target rather than the position keeps a walk free of
+  // drift even if a step is applied before the last one has finished
+  AngleQ8 newTarget = JointMotion::offset(joint.getTarget(), delta,
+                                          _board.servoSafeMin(), _board.servoSafeMax());
 
   // Get speed from board (handles constant speed or duration-based calculation)
-  float distance = abs((float)delta);
-  float speed = _board.servoSpeed(duration, distance);
+  AngleQ8 distance = JointMotion::degrees(delta < 0 ? -delta : delta);
+  SpeedQ16 speed = _board.servoSpeed(duration, distance);
 
   joint.setTarget(newTarget, speed);
 }
 
 void MultiStepGait::advance() {
-  // Caller must verify body.atTarget() before calling advance()
+  // Caller must verify body.atTarget() before calling advance(),
+  // unless the current step overlapsNextStep()
 
-  // If already at last step (non-looping), mark as complete and don't advance
-  if (!_sequenceData->looping && _currentStepIndex >= _sequenceData->stepCount - 1) {
+  // If already at last step of the last cycle, mark as complete and don't advance
+  if (!wrapsAround() && _currentStepIndex >= _sequenceData->stepCount - 1) {
     _stepInProgress = false;  // This makes isComplete() return true
     return;
   }
@@ -92,21 +131,53 @@ void MultiStepGait::advance() {
   // It will be set to true when applyGait() is called for the new step
   _currentStepIndex++;
 
-  // Handle looping (wrap back to start)
-  if (_sequenceData->looping && _currentStepIndex >= _sequenceData->stepCount) {
+  // Handle looping (wrap back to start of the next cycle)
+  if (_currentStepIndex >= _sequenceData->stepCount) {
     _currentStepIndex = 0;
+    _cycle++;
   }
+  loadStep();
 }
 
 bool MultiStepGait::isComplete() const {
-  return !_sequenceData->looping &&
+  return !wrapsAround() &&
          _currentStepIndex >= _sequenceData->stepCount - 1 &&
          !_stepInProgress;
 }
 
+bool MultiStepGait::overlapsNextStep() const {
+  if (currentStep().waitForCompletion) {
+    return false;
+  }
+  return hasNextStep();
+}
+
+bool MultiStepGait::synchronizesArrival() const {
+  return currentStep().synchronizedArrival;
+}
+
+bool MultiStepGait::hasNextStep() const {
+  return wrapsAround() || _currentStepIndex < _sequenceData->stepCount - 1;
+}
+
 void MultiStepGait::reset() {
   _currentStepIndex = 0;
   _stepInProgress = false;
+  _cycle = 0;
+  loadStep();
+}
+
+void MultiStepGait::setSequenceData(const GaitSequenceData* data) {
+  _sequenceData = data;
+  _compiledSteps = nullptr;
+  _cycles = data->looping ? 0 : 1;
+  reset();
+}
+
+void MultiStepGait::jumpTo(uint8_t step) {
+  _currentStepIndex = step < _sequenceData->stepCount ? step : 0;
+  _stepInProgress = false;
+  loadStep();
 }
 
 uint8_t MultiStepGait::getCurrentStep() const {
@@ -4,13 +4,23 @@
 #include "gait_sequence.h"
 #include "board.h"
 #include "leg.h"
+#include "robot_topology.h"
 #include <profiler.h>
 
+namespace GaitCompiler {
+  struct CompiledStep;
+}
+
 // Represents movement for a single leg's joints
+// The tibia (3-DOF builds only) comes last so existing {shoulder, knee, duration}
+// tables keep their meaning and simply hold the tibia still
 struct LegMovement {
   int8_t shoulderDelta;  // Relative angle change for shoulder in degrees (0 = no movement)
   int8_t kneeDelta;      // Relative angle change for knee in degrees (0 = no movement)
   uint16_t duration;     // Time to complete movement in milliseconds
+#if ROBOT_LEG_DOF == 3
+  int8_t tibiaDelta;     // Relative angle change for tibia in degrees (0 = no movement)
+#endif
 };
 
 // Represents one step in a multi-step sequence
@@ -24,6 +34,7 @@ struct GaitStep {
   LegMovement rightMiddle;       // Right Middle leg movement
   LegMovement rightRear;         // Right Rear leg movement
   bool waitForCompletion;        // If true, wait for all joints to reach target before advancing
+  bool synchronizedArrival;      // If true, every joint is timed to arrive with the slowest one
 };
 
 // A complete multi-step gait sequence
@@ -31,19 +42,34 @@ struct GaitSequenceData {
   const char* name;              // Sequence name (e.g., "Forward Walk")
   const GaitStep* steps;         // Array of steps
   uint8_t stepCount;             // Number of steps in sequence
-  bool looping;                  // If true, repeat sequence when complete
+  bool looping;                  // If true, repeat sequence when complete (see setCycles)
+  const LegMovement* startPose;  // Each leg's angles from middle before step 0, LF..RR (nullptr = middle)
+  const uint8_t* blob;           // Validated gait_format.h blob to read steps from when steps is nullptr
 };
 
 class MultiStepGait : public GaitSequence {
   private:
     Board _board;
     const GaitSequenceData* _sequenceData;
+    const GaitCompiler::CompiledStep* _compiledSteps;  // nullptr = apply the deltas
     uint8_t _currentStepIndex;
+    GaitStep _blobStep;          // Current step of a blob-backed gait, read in place of a table
     bool _stepInProgress;
+    uint16_t _cycles;            // Cycles to run, 0 = until stopped
+    uint16_t _cycle;             // Cycles completed since reset()
+
+    // True if the last step runs on into step 0 of another cycle
+    bool wrapsAround() const { return _cycles == 0 || _cycle + 1 < _cycles; }
 
     // Call rate profiling
     CallRateProfiler _applyProfiler;
 
+    // The step being walked - from the table, or read from the blob by loadStep()
+    const GaitStep& currentStep() const {
+      return _sequenceData->steps != nullptr ? _sequenceData->steps[_currentStepIndex] : _blobStep;
+    }
+    void loadStep();
+
     // Helper to apply movement to a leg's joints
     void applyLegMovement(Leg& leg, const LegMovement& movement);
 
@@ -53,6 +79,9 @@ class MultiStepGait : public GaitSequence {
   public:
     MultiStepGait(const GaitSequenceData* data);
 
+    // Same gait, applied from its compiled steps (COMPILE_GAIT(*data).steps)
+    MultiStepGait(const GaitSequenceData* data, const GaitCompiler::CompiledStep* compiledSteps);
+
     // GaitSequence interface - each method handles its specific leg independently
     void applyTo(LeftFrontLeg& leg) override;
     void applyTo(LeftMiddleLeg& leg) override;
@@ -64,12 +93,34 @@ class MultiStepGait : public GaitSequence {
     const char* getName() const override;
     const char* getStepName() const override;
     uint8_t getStepIndex() const override { return _currentStepIndex; }
+    bool synchronizesArrival() const override;
+    bool hasNextStep() const override;
+    bool applyCompiled(JointStates& states) override;
 
     // Multi-step specific control
     void advance();              // Move to next step in sequence
     bool isComplete() const;     // True if all steps executed
     void reset();                // Return to step 0
+    void jumpTo(uint8_t step);   // Continue from step instead (e.g. after a transition)
     uint8_t getCurrentStep() const;
+    uint8_t getStepCount() const { return _sequenceData->stepCount; }
+    const GaitSequenceData* getSequenceData() const { return _sequenceData; }
+
+    // Run another sequence (applied from its deltas) from step 0, with its
+    // default cycles - e.g. a gait loaded at runtime. A blob-backed
+    // sequence is read one step at a time as the gait advances
+    void setSequenceData(const GaitSequenceData* data);
+
+    // Run the sequence this many times back to back, 0 = until stopped.
+    // Defaults to the data's looping flag (0 if looping, otherwise 1)
+    void setCycles(uint16_t cycles) { _cycles = cycles; }
+    uint16_t getCycles() const { return _cycles; }
+    uint16_t getCycle() const { return _cycle; }
+
+    // True if the current step does not wait for completion and there is a
+    // next step to start alongside it (the last step of the last cycle
+    // always waits, so the gait does not finish mid-move)
+    bool overlapsNextStep() const;
 
     // For testing: mark that a step has been applied and is in progress
     void markStepInProgress() { _stepInProgress = true; }
@@ -7,10 +7,9 @@ OneSweepSequence::OneSweepSequence() : _movingToMax(true) {
 
 void OneSweepSequence::applySweepToJoint(Joint& joint) {
   // Use safe angle range with offset from extremes to avoid servo issues
-  // Using 2-degree safety margin from 0-180 degree range
-  const float offset = 2.0f;
-  const float safeMin = _board.servoMin() + offset;  // 2.0 degrees
-  const float safeMax = _board.servoMax() - offset;  // 178.0 degrees
+  // (2-degree safety margin from 0-180 degree range)
+  const AngleQ8 safeMin = _board.servoSafeMin();  // 2.0 degrees
+  const AngleQ8 safeMax = _board.servoSafeMax();  // 178.0 degrees
 
   if (_movingToMax) {
     joint.setTarget(safeMax, _speed);
@@ -8,7 +8,7 @@
  * Oscillating test sequence that sweeps servos from min to max and back.
  *
  * - Alternates between moving to max and moving to min
- * - Body::atTarget() determines when to switch direction
+ * - Body's motion complete callback determines when to switch direction
  *
  * Speed calculation:
  * - Range: 180 degrees (0° to 180°)
@@ -18,7 +18,7 @@
 class OneSweepSequence : public GaitSequence {
   private:
     Board _board;
-    float _speed;       // Speed in degrees per second
+    SpeedQ16 _speed;    // Speed (Q16.16 degrees per millisecond)
     bool _movingToMax;  // Track direction: true = moving to max, false = moving to min
 
     // Helper method to apply sweep movement to a joint
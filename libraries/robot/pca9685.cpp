@@ -0,0 +1,75 @@
+#include <pca9685.h>
+#include <logging.h>
+#include <Arduino.h>
+
+Pca9685::Pca9685(II2cBus& bus, uint8_t address)
+  : _bus(bus), _address(address), _initialized(false) {
+}
+
+bool Pca9685::writeRegister(uint8_t reg, uint8_t value) {
+  uint8_t data[2] = { reg, value };
+  return _bus.write(_address, data, sizeof(data));
+}
+
+bool Pca9685::readRegister(uint8_t reg, uint8_t& value) {
+  return _bus.read(_address, reg, &value, 1);
+}
+
+bool Pca9685::begin(uint32_t oscillatorHz, uint16_t pwmFreqHz) {
+  // Check-and-initialize - called before the output task exists
+  // See docs/adr/005-servo-output-task.md for the threading model
+  if (_initialized) {
+    return true;  // Already initialized
+  }
+
+  // Reset (matches Adafruit driver sequence)
+  if (!writeRegister(REG_MODE1, MODE1_RESTART)) {
+    Log::println("PCA9685: no ACK at 0x%02X", _address);
+    return false;
+  }
+  delay(10);
+
+  // prescale = round(osc / (4096 * freq)) - 1, limited to the chip's 3..255
+  uint32_t prescale = (oscillatorHz + (2048UL * pwmFreqHz)) / (4096UL * pwmFreqHz) - 1;
+  prescale = constrain(prescale, 3UL, 255UL);
+
+  // Prescale can only be written while the oscillator is asleep
+  uint8_t oldMode = 0;
+  readRegister(REG_MODE1, oldMode);
+  uint8_t sleepMode = (oldMode & ~MODE1_RESTART) | MODE1_SLEEP;
+  writeRegister(REG_MODE1, sleepMode);
+  writeRegister(REG_PRESCALE, (uint8_t)prescale);
+  writeRegister(REG_MODE1, oldMode);
+  delay(5);
+
+  // Restart with auto-increment so bursts walk through consecutive registers
+  writeRegister(REG_MODE1, oldMode | MODE1_RESTART | MODE1_AI);
+
+  _initialized = true;
+  Log::println("PCA9685: initialized at 0x%02X (%d Hz, prescale %d)",
+               _address, pwmFreqHz, (int)prescale);
+  return true;
+}
+
+bool Pca9685::writeChannel(uint8_t channel, uint16_t off) {
+  return writeChannels(channel, &off, 1);
+}
+
+bool Pca9685::writeChannels(uint8_t firstChannel, const uint16_t* off, uint8_t count) {
+  if (count == 0 || firstChannel + count > CHANNEL_COUNT) {
+    return false;
+  }
+
+  // Register pointer followed by ON_L, ON_H, OFF_L, OFF_H per channel
+  uint8_t data[1 + CHANNEL_COUNT * BYTES_PER_CHANNEL];
+  uint8_t length = 0;
+  data[length++] = REG_LED0_ON_L + firstChannel * BYTES_PER_CHANNEL;
+  for (uint8_t i = 0; i < count; i++) {
+    data[length++] = 0;
+    data[length++] = 0;
+    data[length++] = off[i] & 0xFF;
+    data[length++] = (off[i] >> 8) & 0x1F;
+  }
+
+  return _bus.write(_address, data, length);
+}
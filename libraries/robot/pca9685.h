@@ -0,0 +1,68 @@
+#ifndef PCA9685_H
+#define PCA9685_H
+
+#include <stdint.h>
+#include <i_i2c_bus.h>
+
+#define PCA9685_DEFAULT_ADDRESS 0x40
+
+/*
+ * Minimal PCA9685 16-channel PWM driver.
+ *
+ * Talks to the chip through an II2cBus so the exact bus traffic can be
+ * observed on the host. Auto-increment is enabled in begin(), which lets
+ * consecutive channels be written in one burst transaction instead of
+ * one transaction per channel.
+ */
+class Pca9685 {
+  public:
+    static const uint8_t CHANNEL_COUNT = 16;
+
+    // Register map (datasheet section 7.3)
+    static const uint8_t REG_MODE1 = 0x00;
+    static const uint8_t REG_SUBADR1 = 0x02;  // SUBADR1-3 are plain R/W registers
+    static const uint8_t REG_LED0_ON_L = 0x06;
+    static const uint8_t REG_PRESCALE = 0xFE;
+
+    // MODE1 bits
+    static const uint8_t MODE1_RESTART = 0x80;
+    static const uint8_t MODE1_AI = 0x20;
+    static const uint8_t MODE1_SLEEP = 0x10;
+
+    // Bytes per channel: ON_L, ON_H, OFF_L, OFF_H
+    static const uint8_t BYTES_PER_CHANNEL = 4;
+
+    // OFF value with the full-off bit (OFF_H bit 4) set - output held low,
+    // so the servo gets no pulses and stops holding position
+    static const uint16_t FULL_OFF = 0x1000;
+
+  private:
+    II2cBus& _bus;
+    uint8_t _address;
+
+    // Initialization flag - begin() runs before the output task starts,
+    // after which only that task touches the driver
+    // See docs/adr/005-servo-output-task.md
+    bool _initialized;
+
+    bool writeRegister(uint8_t reg, uint8_t value);
+    bool readRegister(uint8_t reg, uint8_t& value);
+
+  public:
+    Pca9685(II2cBus& bus, uint8_t address = PCA9685_DEFAULT_ADDRESS);
+
+    // Reset the chip, set the PWM frequency and enable register auto-increment
+    bool begin(uint32_t oscillatorHz = 27000000, uint16_t pwmFreqHz = 50);
+
+    // Write a single channel (one transaction, 5 data bytes)
+    bool writeChannel(uint8_t channel, uint16_t off);
+
+    // Write consecutive channels starting at firstChannel in one burst
+    // transaction (1 + 4 * count data bytes). ON time is always 0.
+    bool writeChannels(uint8_t firstChannel, const uint16_t* off, uint8_t count);
+
+    uint8_t getAddress() const { return _address; }
+    bool isInitialized() const { return _initialized; }
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "phase_gait.h"
+#include <logging.h>
+
+PhaseGait::PhaseGait(const PhaseGaitData* data)
+  : _data(data),
+    _stanceMs(data->stanceMs),
+    _cycleMs((uint32_t)data->stanceMs * 256 / data->dutyFactor),
+    _clockMs(0) {
+  for (uint8_t i = 0; i < Topology::LEG_COUNT; i++) {
+    _dueMs[i] = 0;
+    _legTimeMs[i] = 0;
+  }
+}
+
+uint32_t PhaseGait::phaseTime(uint8_t phase) const {
+  // Stance phases 0-127 span stanceMs, swing phases 128-255 the rest
+  if (phase < 128) {
+    return phase * _stanceMs / 128;
+  }
+  return _stanceMs + (phase - 128) * (_cycleMs - _stanceMs) / 128;
+}
+
+uint8_t PhaseGait::nextKeyframe(uint32_t t) const {
+  for (uint8_t k = 0; k < _data->keyframeCount; k++) {
+    if (phaseTime(_data->keyframes[k].phase) > t) {
+      return k;
+    }
+  }
+  return 0;
+}
+
+void PhaseGait::poseAt(uint32_t t, int16_t* angles) const {
+  uint8_t next = nextKeyframe(t);
+  uint8_t prev = next > 0 ? next - 1 : _data->keyframeCount - 1;
+  const LegKeyframe& a = _data->keyframes[prev];
+  const LegKeyframe& b = _data->keyframes[next];
+
+  // Times either side of t, unwrapped across the end of the cycle
+  uint32_t ta = phaseTime(a.phase);
+  uint32_t tb = phaseTime(b.phase);
+  if (tb <= ta) tb += _cycleMs;
+  if (t < ta) t += _cycleMs;
+  int32_t span = (int32_t)(tb - ta);
+  int32_t into = (int32_t)(t - ta);
+
+  const int8_t from[] = { a.shoulder, a.knee,
+#if ROBOT_LEG_DOF == 3
+                          a.tibia,
+#endif
+                        };
+  const int8_t to[] = { b.shoulder, b.knee,
+#if ROBOT_LEG_DOF == 3
+                        b.tibia,
+#endif
+                      };
+  for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+    angles[j] = span > 0 ? from[j] + (to[j] - from[j]) * into / span : to[j];
+  }
+}
+
+void PhaseGait::moveLeg(Leg& leg, const int16_t* angles, uint32_t durationMs) {
+  // Right legs mirror the left: forward and lift are the other way round
+  bool mirrored = leg.getIndex() >= Topology::LEG_COUNT / 2;
+  for (uint8_t j = 0; j < Topology::JOINTS_PER_LEG; j++) {
+    int8_t angle = (int8_t)(mirrored ? -angles[j] : angles[j]);
+    AngleQ8 target = JointMotion::offset(_board.servoMiddle(), angle,
+                                         _board.servoSafeMin(), _board.servoSafeMax());
+    leg.joint(j).setTargetTimed(target, durationMs);
+  }
+}
+
+void PhaseGait::start(Body& body, uint16_t stanceMs) {
+  _stanceMs = stanceMs > 0 ? stanceMs : _data->stanceMs;
+  _cycleMs = _stanceMs * 256 / _data->dutyFactor;
+  _clockMs = 0;
+
+  Log::println("PhaseGait: %s, %lums cycle", _data->name, (unsigned long)_cycleMs);
+
+  int16_t angles[Topology::JOINTS_PER_LEG];
+  for (uint8_t i = 0; i < Topology::LEG_COUNT; i++) {
+    _legTimeMs[i] = _data->legPhase[i] * _cycleMs / 256;
+    _dueMs[i] = LEAD_IN_MS;
+    poseAt(_legTimeMs[i], angles);
+    moveLeg(body.leg(i), angles, LEAD_IN_MS);
+  }
+}
+
+void PhaseGait::update(Body& body, uint32_t deltaMs) {
+  _clockMs += deltaMs;
+
+  int16_t angles[Topology::JOINTS_PER_LEG];
+  for (uint8_t i = 0; i < Topology::LEG_COUNT; i++) {
+    if (_clockMs < _dueMs[i]) {
+      continue;
+    }
+
+    // Head for the next keyframe, timed from when this pose was due so a
+    // late frame shortens the move instead of delaying the leg
+    const LegKeyframe& key = _data->keyframes[nextKeyframe(_legTimeMs[i])];
+    uint32_t keyTime = phaseTime(key.phase);
+    uint32_t segmentMs = keyTime > _legTimeMs[i] ? keyTime - _legTimeMs[i]
+                                                 : keyTime + _cycleMs - _legTimeMs[i];
+    _legTimeMs[i] = keyTime;
+    _dueMs[i] += segmentMs;
+
+    angles[Topology::SHOULDER] = key.shoulder;
+    angles[Topology::KNEE] = key.knee;
+#if ROBOT_LEG_DOF == 3
+    angles[Topology::TIBIA] = key.tibia;
+#endif
+    moveLeg(body.leg(i), angles, _dueMs[i] > _clockMs ? _dueMs[i] - _clockMs : 1);
+  }
+}
@@ -0,0 +1,87 @@
+#ifndef PHASE_GAIT_H
+#define PHASE_GAIT_H
+
+#include "board.h"
+#include "body.h"
+#include "robot_topology.h"
+
+// One pose in a leg's cycle, in degrees from the servo middle
+// Written for a left leg (shoulder + = forward, knee - = lift); right
+// legs are mirrored, as in the multi-step gait tables
+struct LegKeyframe {
+  uint8_t phase;         // Position in the cycle: 0-127 stance, 128-255 swing
+  int8_t shoulder;       // Shoulder angle from middle in degrees
+  int8_t knee;           // Knee angle from middle in degrees
+#if ROBOT_LEG_DOF == 3
+  int8_t tibia;          // Tibia angle from middle in degrees
+#endif
+};
+
+// A cyclic gait where every leg runs the same keyframes at its own offset
+struct PhaseGaitData {
+  const char* name;              // Gait name (e.g., "Wave")
+  const LegKeyframe* keyframes;  // One leg's cycle, phase ascending
+  uint8_t keyframeCount;         // Number of keyframes
+  uint16_t stanceMs;             // Time each leg spends on the ground per cycle
+  uint8_t dutyFactor;            // Share of the cycle on the ground, out of 256
+  uint8_t legPhase[Topology::LEG_COUNT];  // Each leg's offset into the cycle, out of 256 (LF..RR)
+};
+
+/*
+ * Per-leg phase scheduler for cyclic gaits (tripod, ripple, wave).
+ *
+ * Instead of one GaitStep for all six legs and a barrier until every
+ * joint arrives, each leg runs its own timeline through the keyframes,
+ * offset into a shared cycle by its legPhase. Keyframe phases are
+ * stretched so stance lasts stanceMs and swing stanceMs * (256 - duty) /
+ * duty - the duty factor, not the slowest joint, sets the cycle time.
+ *
+ * Each move is timed to land on its keyframe's time (see
+ * JointStates::setTargetTimed), and the next keyframe is scheduled from
+ * that time rather than from arrival, so legs never drift out of phase.
+ * Call update() once per control frame, after Body::update().
+ */
+class PhaseGait {
+  private:
+    Board _board;
+    const PhaseGaitData* _data;
+    uint32_t _stanceMs;
+    uint32_t _cycleMs;
+    uint32_t _clockMs;                          // Time since start()
+    uint32_t _dueMs[Topology::LEG_COUNT];       // Clock time each leg reaches its next pose
+    uint32_t _legTimeMs[Topology::LEG_COUNT];   // That pose's time within the cycle
+
+    // Time within the cycle of a keyframe phase
+    uint32_t phaseTime(uint8_t phase) const;
+
+    // First keyframe after cycle time t (wrapping to the first)
+    uint8_t nextKeyframe(uint32_t t) const;
+
+    // Move leg to keyframe angles (mirrored for right legs) in durationMs
+    void moveLeg(Leg& leg, const int16_t* angles, uint32_t durationMs);
+
+    // Leg angles at cycle time t, between the keyframes either side
+    void poseAt(uint32_t t, int16_t* angles) const;
+
+  public:
+    // Time to settle every leg onto its starting pose
+    static const uint32_t LEAD_IN_MS = 500;
+
+    PhaseGait(const PhaseGaitData* data);
+
+    const char* getName() const { return _data->name; }
+    uint32_t getCycleMs() const { return _cycleMs; }
+    uint32_t getStanceMs() const { return _stanceMs; }
+
+    // Start the cycle - every leg moves to its offset pose over LEAD_IN_MS
+    // stanceMs of 0 keeps the gait's own
+    void start(Body& body, uint16_t stanceMs = 0);
+
+    // Advance the clock and give legs that reached their pose the next one
+    void update(Body& body, uint32_t deltaMs);
+
+    // Leg's time within the cycle at its next pose (for testing)
+    uint32_t getLegTime(uint8_t leg) const { return _legTimeMs[leg]; }
+};
+
+#endif
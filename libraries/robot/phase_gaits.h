@@ -0,0 +1,57 @@
+#ifndef PHASE_GAITS_H
+#define PHASE_GAITS_H
+
+#include "phase_gait.h"
+
+// One leg's walking cycle, shared by every phase gait
+// Stance pushes the foot back along the ground, swing lifts it, carries
+// it forward and puts it down again (same ±10° / 23° as the forward walk)
+const LegKeyframe WALK_KEYFRAMES[] = {
+#if ROBOT_LEG_DOF == 3
+  {   0, +10,   0, 0 },    // Foot down, forward - stance begins
+  { 128, -10,   0, 0 },    // Foot down, back - swing begins
+  { 160, -10, -23, 0 },    // Lift
+  { 224, +10, -23, 0 },    // Carry forward, then lower into the next stance
+#else
+  {   0, +10,   0 },       // Foot down, forward - stance begins
+  { 128, -10,   0 },       // Foot down, back - swing begins
+  { 160, -10, -23 },       // Lift
+  { 224, +10, -23 },       // Carry forward, then lower into the next stance
+#endif
+};
+
+// Tripod: two groups of three alternate, half the cycle on the ground
+// Tripod A: Left Front, Left Rear, Right Middle
+// Tripod B: Right Front, Right Rear, Left Middle
+const PhaseGaitData TRIPOD_PHASE_GAIT = {
+  "Tripod",
+  WALK_KEYFRAMES,
+  sizeof(WALK_KEYFRAMES) / sizeof(WALK_KEYFRAMES[0]),
+  600,                              // 600ms stance, 1.2s cycle
+  128,                              // Duty factor 1/2
+  {   0, 128,   0, 128,   0, 128 }  // LF, LM, LR, RF, RM, RR
+};
+
+// Ripple: each side runs a back-to-front wave, the sides half a cycle
+// apart - two legs off the ground at most, two thirds of the cycle down
+const PhaseGaitData RIPPLE_PHASE_GAIT = {
+  "Ripple",
+  WALK_KEYFRAMES,
+  sizeof(WALK_KEYFRAMES) / sizeof(WALK_KEYFRAMES[0]),
+  600,                              // 600ms stance, ~900ms cycle
+  171,                              // Duty factor 2/3
+  {   0,  85, 171, 128, 213,  43 }  // LF, LM, LR, RF, RM, RR
+};
+
+// Wave: one leg swings at a time, rear to front, left side then right -
+// slowest and most stable, five sixths of the cycle on the ground
+const PhaseGaitData WAVE_PHASE_GAIT = {
+  "Wave",
+  WALK_KEYFRAMES,
+  sizeof(WALK_KEYFRAMES) / sizeof(WALK_KEYFRAMES[0]),
+  1500,                             // 1.5s stance, ~1.8s cycle
+  213,                              // Duty factor 5/6
+  { 128, 171, 213,   0,  43,  85 }  // LF, LM, LR, RF, RM, RR
+};
+
+#endif
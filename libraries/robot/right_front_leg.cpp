@@ -1,6 +1,5 @@
 #include <right_front_leg.h>
 
-RightFrontLeg::RightFrontLeg(Servo &shoulderServo, Servo &kneeServo,
-                             uint16_t shoulderInitial, uint16_t kneeInitial)
-  : Leg(shoulderServo, kneeServo, shoulderInitial, kneeInitial) {
+RightFrontLeg::RightFrontLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle)
+  : Leg(board, frame, states, 3, initialAngle) {  // RF in the topology
 }
@@ -8,8 +8,7 @@
  */
 class RightFrontLeg : public Leg {
   public:
-    RightFrontLeg(Servo &shoulderServo, Servo &kneeServo,
-                  uint16_t shoulderInitial, uint16_t kneeInitial);
+    RightFrontLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle);
 
     const char* getName() const override { return "RightFront"; }
 };
@@ -1,6 +1,5 @@
 #include <right_middle_leg.h>
 
-RightMiddleLeg::RightMiddleLeg(Servo &shoulderServo, Servo &kneeServo,
-                               uint16_t shoulderInitial, uint16_t kneeInitial)
-  : Leg(shoulderServo, kneeServo, shoulderInitial, kneeInitial) {
+RightMiddleLeg::RightMiddleLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle)
+  : Leg(board, frame, states, 4, initialAngle) {  // RM in the topology
 }
@@ -8,8 +8,7 @@
  */
 class RightMiddleLeg : public Leg {
   public:
-    RightMiddleLeg(Servo &shoulderServo, Servo &kneeServo,
-                   uint16_t shoulderInitial, uint16_t kneeInitial);
+    RightMiddleLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle);
 
     const char* getName() const override { return "RightMiddle"; }
 };
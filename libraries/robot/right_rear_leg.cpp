@@ -1,6 +1,5 @@
 #include <right_rear_leg.h>
 
-RightRearLeg::RightRearLeg(Servo &shoulderServo, Servo &kneeServo,
-                           uint16_t shoulderInitial, uint16_t kneeInitial)
-  : Leg(shoulderServo, kneeServo, shoulderInitial, kneeInitial) {
+RightRearLeg::RightRearLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle)
+  : Leg(board, frame, states, 5, initialAngle) {  // RR in the topology
 }
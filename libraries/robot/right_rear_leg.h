@@ -8,8 +8,7 @@
  */
 class RightRearLeg : public Leg {
   public:
-    RightRearLeg(Servo &shoulderServo, Servo &kneeServo,
-                 uint16_t shoulderInitial, uint16_t kneeInitial);
+    RightRearLeg(Board& board, ServoFrame& frame, JointStates& states, AngleQ8 initialAngle);
 
     const char* getName() const override { return "RightRear"; }
 };
@@ -6,17 +6,30 @@
 Robot::Robot()
   : _flasher(),
     _board(),
-    _body(_board),
+    _bus(),
+    _body(_board, _bus),
     _sweep(),
-    _stationaryGait(&STATIONARY_SEQUENCE),
-    _forwardGait(&FORWARD_WALK_SEQUENCE),
-    _backwardGait(&BACKWARD_SEQUENCE),
-    _leftGait(&LEFT_SEQUENCE),
-    _rightGait(&RIGHT_SEQUENCE),
+    _stationaryGait(&STATIONARY_SEQUENCE, STATIONARY_COMPILED.steps),
+    _forwardGait(&FORWARD_WALK_SEQUENCE, FORWARD_WALK_COMPILED.steps),
+    _backwardGait(&BACKWARD_SEQUENCE, BACKWARD_COMPILED.steps),
+    _leftGait(&LEFT_SEQUENCE, LEFT_COMPILED.steps),
+    _rightGait(&RIGHT_SEQUENCE, RIGHT_COMPILED.steps),
+    _transition(),
+    _transitionGait(_transition.getSequenceData()),
+    _transitionCommand(""),
+    _generator(),
+    _generatedGait(_generator.getSequenceData()),
+    _arena(),
+    _library(),
+    _runGait(&STATIONARY_SEQUENCE),
+    _tripodGait(&TRIPOD_PHASE_GAIT),
+    _rippleGait(&RIPPLE_PHASE_GAIT),
+    _waveGait(&WAVE_PHASE_GAIT),
+    _phaseGait(nullptr),
     _commandRouter(),
     _bluetooth(),
     _memoryProfiler(false), // Profiling disabled by default
-    _lastUpdateMs(0),
+    _frameClock(_board.pwmFrequency()),
     _firstLoop(true),
     _isMoving(false),
     _currentCommand("") {
@@ -47,11 +60,21 @@ void Robot::setup() {
   setupCommands();
   yield(); // Yield to watchdog
 
+  // I2C bus for the PWM servo driver, clocked at the fastest rate
+  // this wiring handles reliably
+  _bus.begin(_board.pwmSDA(), _board.pwmSCL());
+  BusBenchmark busBench(_bus);
+  busBench.run();
+  busBench.logResults();
+  yield(); // Yield to watchdog
+
   // DEBUG: Re-enabled - testing Body::begin() incrementally
   _body.begin();
+  _body.onMotionComplete([this]() { handleMotionComplete(); });
   yield(); // Yield to watchdog
 
-  _lastUpdateMs = millis();
+  // Gait library, read in place from its flash partition (empty if not flashed)
+  _library.openPartition("gaits");
 
   // Memory diagnostics after initialization
   Log::println("After init - Free heap: %d bytes", ESP.getFreeHeap());
@@ -72,10 +95,7 @@ void Robot::loop() {
   // Process incoming Bluetooth messages
   _bluetooth.update();
 
-  // Calculate elapsed time since last update
   uint32_t currentMs = millis();
-  uint32_t deltaMs = currentMs - _lastUpdateMs;
-  _lastUpdateMs = currentMs;
 
   // Periodic diagnostics (if enabled)
   _memoryProfiler.update(currentMs);
@@ -85,105 +105,119 @@ void Robot::loop() {
   _backwardGait.updateProfiler(currentMs);
   _leftGait.updateProfiler(currentMs);
   _rightGait.updateProfiler(currentMs);
+  _body.getServoWriteProfiler().update(currentMs);
 
   _flasher.flash(currentMs);
 
-  // Limit deltaMs on first loop to prevent huge jumps
-  if (deltaMs > 100) {
-    deltaMs = 100; // Cap at 100ms to prevent issues
+  // Joint math runs once per control frame, one frame's time per step
+  // (first poll starts the clock; late frames are counted, not replayed,
+  // and the step after them covers their time so moves stay on schedule)
+  if (!_frameClock.poll(micros())) {
+    return;
   }
+  uint32_t deltaMs = _frameClock.getElapsedMs();
 
-  // Update all legs (time-based movement) only if actively moving
+  // Update all legs (time-based movement) only if actively moving.
+  // Arrival is reported through handleMotionComplete()
   if (_isMoving) {
     _body.update(deltaMs);
 
-    // When target is reached, advance to next step and reapply gait
-    if (_body.atTarget()) {
-      if (_currentCommand == "sweep") {
-        _sweep.toggleDirection();
-        _body.applyGait(_sweep);
-      } else if (_currentCommand == "forward") {
-        if (!_forwardGait.isComplete()) {
-          uint8_t completedStep = _forwardGait.getCurrentStep();
-          yield();  // Yield before step transition
-          _forwardGait.advance();
-          yield();  // Yield after advance
-
-          // Check if complete AFTER advance (last step may have just finished)
-          if (!_forwardGait.isComplete()) {
-            Log::debugln("Robot: Step %d complete, advancing to step %d",
-                         completedStep, _forwardGait.getCurrentStep());
-            _body.applyGait(_forwardGait);
-            yield();  // Yield after applying new gait
-          } else {
-            Log::debugln("Robot: Step %d complete, gait finished", completedStep);
-            _currentCommand = "stationary";
-            _body.applyGait(_stationaryGait);
-            _isMoving = false;
-          }
-        } else {
-          Log::debugln("Robot: Forward gait already complete");
-          _currentCommand = "stationary";
-          _body.applyGait(_stationaryGait);
-          _isMoving = false;
-        }
-      } else if (_currentCommand == "backward") {
-        if (!_backwardGait.isComplete()) {
-          yield();
-          _backwardGait.advance();
-          yield();
-          if (!_backwardGait.isComplete()) {
-            _body.applyGait(_backwardGait);
-            yield();
-          } else {
-            _currentCommand = "stationary";
-            _body.applyGait(_stationaryGait);
-            _isMoving = false;
-          }
-        } else {
-          _currentCommand = "stationary";
-          _body.applyGait(_stationaryGait);
-          _isMoving = false;
-        }
-      } else if (_currentCommand == "left") {
-        if (!_leftGait.isComplete()) {
-          yield();
-          _leftGait.advance();
-          yield();
-          if (!_leftGait.isComplete()) {
-            _body.applyGait(_leftGait);
-            yield();
-          } else {
-            _currentCommand = "stationary";
-            _body.applyGait(_stationaryGait);
-            _isMoving = false;
-          }
-        } else {
-          _currentCommand = "stationary";
-          _body.applyGait(_stationaryGait);
-          _isMoving = false;
-        }
-      } else if (_currentCommand == "right") {
-        if (!_rightGait.isComplete()) {
-          yield();
-          _rightGait.advance();
-          yield();
-          if (!_rightGait.isComplete()) {
-            _body.applyGait(_rightGait);
-            yield();
-          } else {
-            _currentCommand = "stationary";
-            _body.applyGait(_stationaryGait);
-            _isMoving = false;
-          }
-        } else {
-          _currentCommand = "stationary";
-          _body.applyGait(_stationaryGait);
-          _isMoving = false;
-        }
-      }
+    // Phase gaits keep each leg on its own timeline instead of waiting
+    // for arrival - give legs that reached their pose the next one
+    if (_currentCommand == "walk") {
+      _phaseGait->update(_body, deltaMs);
+    }
+  } else {
+    // Stationary - let legs that stay put stop holding position
+    _body.updateIdle(deltaMs);
+  }
+}
+
+void Robot::handleMotionComplete() {
+  // Called by Body::update() once every joint has reached the current
+  // step's targets - advance to next step and reapply gait
+  if (_currentCommand == "sweep") {
+    _sweep.toggleDirection();
+    _body.applyGait(_sweep);
+    return;
+  }
+
+  MultiStepGait* gait = activeGait();
+  if (gait == nullptr) {
+    // One-off moves (foot, reset) are finished once they arrive - stop
+    // updating so idle legs can release. Phase gaits never arrive
+    if (_currentCommand != "walk") {
+      _isMoving = false;
     }
+    return;
+  }
+
+  if (gait->isComplete()) {
+    Log::debugln("Robot: %s gait already complete", gait->getName());
+    endGait();
+    return;
   }
+
+  uint8_t completedStep = gait->getCurrentStep();
+  yield();  // Yield before step transition
+  gait->advance();
+  yield();  // Yield after advance
+
+  // Check if complete AFTER advance (last step may have just finished)
+  if (gait->isComplete()) {
+    Log::debugln("Robot: Step %d complete, gait finished", completedStep);
+    endGait();
+    return;
+  }
+
+  Log::debugln("Robot: Step %d complete, advancing to step %d",
+               completedStep, gait->getCurrentStep());
+  applyGaitSteps(*gait);
+  yield();  // Yield after applying new gait
+}
+
+MultiStepGait* Robot::activeGait() {
+  if (_currentCommand == "forward") return &_forwardGait;
+  if (_currentCommand == "backward") return &_backwardGait;
+  if (_currentCommand == "left") return &_leftGait;
+  if (_currentCommand == "right") return &_rightGait;
+  if (_currentCommand == "gait") return &_generatedGait;
+  if (_currentCommand == "run") return &_runGait;
+  if (_currentCommand == "transition") return &_transitionGait;
+  return nullptr;
+}
+
+void Robot::applyGaitSteps(MultiStepGait& gait) {
+  _body.applyGait(gait);
+
+  // Steps marked waitForCompletion = false start the next step straight
+  // away, so their joints move alongside it. Bounded by the step count so
+  // a looping gait with no blocking step cannot spin here
+  uint8_t chained = 0;
+  while (gait.overlapsNextStep() && ++chained < gait.getStepCount()) {
+    uint8_t overlappedStep = gait.getCurrentStep();
+    gait.advance();
+    Log::debugln("Robot: Step %d does not wait, applying step %d",
+                 overlappedStep, gait.getCurrentStep());
+    _body.applyGait(gait);
+  }
+}
+
+void Robot::endGait() {
+  if (_currentCommand == "transition") {
+    _currentCommand = _transitionCommand;
+    Log::debugln("Robot: Transition complete, continuing %s at step %d",
+                 _currentCommand.c_str(), activeGait()->getCurrentStep());
+    applyGaitSteps(*activeGait());
+    return;
+  }
+  finishGait();
+}
+
+void Robot::finishGait() {
+  _currentCommand = "stationary";
+  _body.applyGait(_stationaryGait);
+  _isMoving = false;
 }
 
 void Robot::setupCommands() {
@@ -193,16 +227,79 @@ void Robot::setupCommands() {
   // All handlers receive arguments (even if unused)
   _commandRouter.registerCommand("init", [this](Args args) { handleInitCommand(args); });
   _commandRouter.registerCommand("reset", [this](Args args) { handleResetCommand(args); });
+
+  // Motion commands walk continuously until "stop" or another motion command
+  // Usage: "forward" to keep walking, "forward <cycles>" e.g., "forward 3"
   _commandRouter.registerCommand("forward", [this](Args args) { handleForwardCommand(args); });
   _commandRouter.registerCommand("backward", [this](Args args) { handleBackwardCommand(args); });
   _commandRouter.registerCommand("left", [this](Args args) { handleLeftCommand(args); });
   _commandRouter.registerCommand("right", [this](Args args) { handleRightCommand(args); });
   _commandRouter.registerCommand("stop", [this](Args args) { handleStopCommand(args); });
 
+  // Continuous walk with a phase per leg - stance time in ms sets the speed
+  // Usage: "walk <tripod|ripple|wave> [<stanceMs>]" e.g., "walk wave 400"
+  _commandRouter.registerCommand("walk", [this](Args args) { handleWalkCommand(args); });
+
+  // Generated gait - regenerates the cycle and walks it until stopped.
+  // Values left out keep their last setting; duty is the percentage on the ground
+  // Usage: "gait" to show, "gait <tripod|ripple|wave> [<stride> [<lift> [<periodMs> [<duty>]]]]"
+  // e.g., "gait ripple 30 25 900"
+  _commandRouter.registerCommand("gait", [this](Args args) { handleGaitCommand(args); });
+
+  // Foot placement - leg 0-5 (LF..RR), mm forward and up from the shoulder pivot
+  // Usage: "foot <leg>" to show, "foot <leg> <x> <z> [<ms>]" to move e.g., "foot 0 20 -40"
+  _commandRouter.registerCommand("foot", [this](Args args) { handleFootCommand(args); });
+
+  // Gait upload - a binary gait (gait_format.h) sent as hex, loaded by name
+  // Usage: "gait-upload begin <bytes>", then "gait-upload data <hex>" until
+  // every byte is sent, then "gait-upload end"
+  _commandRouter.registerCommand("gait-upload", [this](Args args) { handleGaitUploadCommand(args); });
+
+  // Walk an uploaded or flash library gait - continuous, or for a number of cycles
+  // Usage: "run" to list gaits, "run <name> [<cycles>]" e.g., "run crawl 3"
+  _commandRouter.registerCommand("run", [this](Args args) { handleRunCommand(args); });
+
   // Wiggle command for testing individual servo connectivity
   // Usage: "wiggle <servoName>" e.g., "wiggle leftfrontshoulder"
   _commandRouter.registerCommand("wiggle", [this](Args args) { handleWiggleCommand(args); });
 
+  // Calibrate command for per-servo pulse range, saved to NVS
+  // Usage: "calibrate <servoName>" to show, "calibrate <servoName> <min> <mid> <max>" to set
+  _commandRouter.registerCommand("calibrate", [this](Args args) { handleCalibrateCommand(args); });
+
+  // Bus benchmark - measures PCA9685 round trips per I2C clock and retunes
+  // Usage: "bus-bench"
+  _commandRouter.registerCommand("bus-bench", [this](Args args) { handleBusBenchCommand(args); });
+
+  // Idle power saving - switch legs to full-off after <ms> stationary (0 = off)
+  // Usage: "idle" to show, "idle <ms>" to set
+  _commandRouter.registerCommand("idle", [this](Args args) { handleIdleCommand(args); });
+
+  // Servo write budget - maximum servo writes per control frame
+  // Usage: "write-budget" to show statistics, "write-budget <n>" to set
+  _commandRouter.registerCommand("write-budget", [this](Args args) { handleWriteBudgetCommand(args); });
+
+  // Servo write suppression - hysteresis band in PWM ticks, and the
+  // issued/suppressed write counts (logged periodically when "log on")
+  // Usage: "hysteresis" to show, "hysteresis <ticks>" to set, "hysteresis log on|off"
+  _commandRouter.registerCommand("hysteresis", [this](Args args) { handleHysteresisCommand(args); });
+
+  // Control frame rate - a whole number of servo refresh periods per frame
+  // Usage: "frame-rate" to show rate and overruns, "frame-rate <hz>" to set
+  _commandRouter.registerCommand("frame-rate", [this](Args args) { handleFrameRateCommand(args); });
+
+  // Joint velocity profile - acceleration in °/s², jerk in °/s³ (scurve only)
+  // Usage: "profile" to show, "profile <constant|trapezoid|scurve> [<accel> [<jerk>]]" to set
+  _commandRouter.registerCommand("profile", [this](Args args) { handleProfileCommand(args); });
+
+  // Synchronized arrival - every joint in a gait step lands with the slowest one
+  // Usage: "sync" to show, "sync on" or "sync off" to set
+  _commandRouter.registerCommand("sync", [this](Args args) { handleSyncCommand(args); });
+
+  // Blend radius - start the next gait step once every joint is this close (0 = off)
+  // Usage: "blend" to show, "blend <degrees>" to set e.g., "blend 5"
+  _commandRouter.registerCommand("blend", [this](Args args) { handleBlendCommand(args); });
+
   // Test movement command for testing gait logic without hardware
   // Usage: "test-movement <gait>" e.g., "test-movement forward"
   _commandRouter.registerCommand("test-movement", [this](Args args) { handleTestMovementCommand(args); });
@@ -236,6 +333,8 @@ void Robot::handleResetCommand(Args args) {
   _backwardGait.reset();
   _leftGait.reset();
   _rightGait.reset();
+  _generatedGait.reset();
+  _runGait.reset();
 
   // Move all servos to middle position
   _body.resetToMiddle();
@@ -248,48 +347,65 @@ void Robot::handleResetCommand(Args args) {
   _bluetooth.send("OK: Reset to middle position");
 }
 
-void Robot::handleForwardCommand(Args args) {
-  Log::debugln("Robot: Executing FORWARD command");
-  _currentCommand = "forward";
+bool Robot::startGait(MultiStepGait& gait, const char* command, Args args) {
+  // Walk cycles back to back until stopped, or for the number given
+  uint16_t cycles = 0;
+  if (!args.empty()) {
+    long count = args[0].toInt();
+    if (count < 1 || count > 1000) {
+      _bluetooth.send(String("ERROR: Usage: ") + command + " [<cycles>]");
+      return false;
+    }
+    cycles = (uint16_t)count;
+  }
+
   _isMoving = true;
+  gait.reset();  // Reset to step 0
+  gait.setCycles(cycles);
+
+  // Go straight from wherever the legs are (mid-stride of another gait,
+  // or stopped part way) into the nearest step of this one
+  const GaitSequenceData* keyframes = _transition.plan(_body, gait.getSequenceData());
+  gait.jumpTo(_transition.getEntryStep());
+  if (keyframes->stepCount > 0) {
+    _transitionCommand = command;
+    _currentCommand = "transition";
+    _transitionGait.reset();
+    applyGaitSteps(_transitionGait);
+    return true;
+  }
 
-  _forwardGait.reset();  // Reset to step 0
-  _body.applyGait(_forwardGait);
+  _currentCommand = command;
+  applyGaitSteps(gait);
+  return true;
+}
 
-  _bluetooth.send("OK: Moving forward");
+void Robot::handleForwardCommand(Args args) {
+  Log::debugln("Robot: Executing FORWARD command");
+  if (startGait(_forwardGait, "forward", args)) {
+    _bluetooth.send("OK: Moving forward");
+  }
 }
 
 void Robot::handleBackwardCommand(Args args) {
   Log::debugln("Robot: Executing BACKWARD command");
-  _currentCommand = "backward";
-  _isMoving = true;
-
-  _backwardGait.reset();  // Reset to step 0
-  _body.applyGait(_backwardGait);
-
-  _bluetooth.send("OK: Moving backward");
+  if (startGait(_backwardGait, "backward", args)) {
+    _bluetooth.send("OK: Moving backward");
+  }
 }
 
 void Robot::handleLeftCommand(Args args) {
   Log::debugln("Robot: Executing LEFT command");
-  _currentCommand = "left";
-  _isMoving = true;
-
-  _leftGait.reset();  // Reset to step 0
-  _body.applyGait(_leftGait);
-
-  _bluetooth.send("OK: Turning left");
+  if (startGait(_leftGait, "left", args)) {
+    _bluetooth.send("OK: Turning left");
+  }
 }
 
 void Robot::handleRightCommand(Args args) {
   Log::debugln("Robot: Executing RIGHT command");
-  _currentCommand = "right";
-  _isMoving = true;
-
-  _rightGait.reset();  // Reset to step 0
-  _body.applyGait(_rightGait);
-
-  _bluetooth.send("OK: Turning right");
+  if (startGait(_rightGait, "right", args)) {
+    _bluetooth.send("OK: Turning right");
+  }
 }
 
 void Robot::handleStopCommand(Args args) {
@@ -300,6 +416,192 @@ void Robot::handleStopCommand(Args args) {
   _bluetooth.send("OK: Stopped");
 }
 
+void Robot::handleWalkCommand(Args args) {
+  PhaseGait* gait = nullptr;
+  if (!args.empty()) {
+    if (args[0] == "tripod") gait = &_tripodGait;
+    if (args[0] == "ripple") gait = &_rippleGait;
+    if (args[0] == "wave") gait = &_waveGait;
+  }
+  if (gait == nullptr) {
+    _bluetooth.send("ERROR: Usage: walk <tripod|ripple|wave> [<stanceMs>]");
+    return;
+  }
+
+  long stanceMs = 0;
+  if (args.size() > 1) {
+    stanceMs = args[1].toInt();
+    if (stanceMs < 100 || stanceMs > 5000) {
+      _bluetooth.send("ERROR: stanceMs must be 100-5000");
+      return;
+    }
+  }
+
+  Log::debugln("Robot: Executing WALK command (%s)", gait->getName());
+  _currentCommand = "walk";
+  _isMoving = true;
+  _phaseGait = gait;
+  _phaseGait->start(_body, (uint16_t)stanceMs);
+
+  _bluetooth.send(String("OK: Walking ") + gait->getName() + ", " +
+                  String(gait->getCycleMs()) + "ms cycle");
+}
+
+void Robot::handleGaitCommand(Args args) {
+  GaitParameters params = _generator.getParameters();
+  if (args.empty()) {
+    _bluetooth.send(String("OK: gait ") + GaitGenerator::familyName(params.family) +
+                    " stride=" + String(params.strideDeg) +
+                    " lift=" + String(params.liftDeg) +
+                    " period=" + String(params.periodMs) +
+                    "ms duty=" + String(params.dutyFactor * 100 / 256) + "%");
+    return;
+  }
+
+  if (args[0] == "tripod") params.family = GaitFamily::TRIPOD;
+  else if (args[0] == "ripple") params.family = GaitFamily::RIPPLE;
+  else if (args[0] == "wave") params.family = GaitFamily::WAVE;
+  else {
+    _bluetooth.send("ERROR: Usage: gait <tripod|ripple|wave> [<stride> [<lift> [<periodMs> [<duty>]]]]");
+    return;
+  }
+
+  // A new family walks at its own duty factor unless one is given
+  if (params.family != _generator.getParameters().family) {
+    params.dutyFactor = 0;
+  }
+  if (args.size() > 1) params.strideDeg = (int8_t)constrain(args[1].toInt(), -128, 127);
+  if (args.size() > 2) params.liftDeg = (int8_t)constrain(args[2].toInt(), -128, 127);
+  if (args.size() > 3) params.periodMs = (uint16_t)constrain(args[3].toInt(), 0, 65535);
+  if (args.size() > 4) params.dutyFactor = (uint8_t)constrain(args[4].toInt() * 256 / 100, 1, 255);
+
+  if (!_generator.generate(params)) {
+    _bluetooth.send("ERROR: stride -60-60, lift 0-60, periodMs 120-10000, duty 50-94");
+    return;
+  }
+
+  Log::debugln("Robot: Executing GAIT command (%s)", GaitGenerator::familyName(params.family));
+  static const std::vector<String> continuous;
+  if (startGait(_generatedGait, "gait", continuous)) {
+    _bluetooth.send(String("OK: Walking generated ") + GaitGenerator::familyName(params.family));
+  }
+}
+
+void Robot::handleFootCommand(Args args) {
+  long leg = args.empty() ? -1 : args[0].toInt();
+  if (leg < 0 || leg >= Topology::LEG_COUNT || (args.size() != 1 && args.size() != 3 && args.size() != 4)) {
+    _bluetooth.send("ERROR: Usage: foot <leg> [<x> <z> [<ms>]]");
+    return;
+  }
+
+  if (args.size() > 1) {
+    FootPosition foot = { (int16_t)args[1].toInt(), 0, (int16_t)args[2].toInt() };
+    long durationMs = args.size() > 3 ? args[3].toInt() : 500;
+    if (durationMs < 1 || durationMs > 10000) {
+      _bluetooth.send("ERROR: ms must be 1-10000");
+      return;
+    }
+    if (!_body.setFootTarget((uint8_t)leg, foot, (uint32_t)durationMs)) {
+      _bluetooth.send("ERROR: Foot out of reach");
+      return;
+    }
+    Log::debugln("Robot: Executing FOOT command (leg %ld)", leg);
+    _currentCommand = "foot";
+    _isMoving = true;
+    _bluetooth.send("OK: Moving foot " + String(leg));
+    return;
+  }
+
+  FootPosition at = _body.getFootPosition((uint8_t)leg);
+  _bluetooth.send("OK: foot " + String(leg) + " x=" + String(at.x) +
+                  " y=" + String(at.y) + " z=" + String(at.z));
+}
+
+void Robot::handleGaitUploadCommand(Args args) {
+  if (args.size() == 2 && args[0] == "begin") {
+    long size = args[1].toInt();
+    if (!_arena.beginUpload(size > 0 ? (size_t)size : 0)) {
+      _bluetooth.send("ERROR: Gait must be 1-" + String(GaitFormat::MAX_BLOB_SIZE) + " bytes");
+      return;
+    }
+    _bluetooth.send("OK: Ready for " + String(size) + " bytes");
+    return;
+  }
+
+  if (args.size() == 2 && args[0] == "data") {
+    if (!_arena.appendHex(args[1].c_str())) {
+      _bluetooth.send("ERROR: Bad gait data, upload dropped");
+      return;
+    }
+    _bluetooth.send("OK: " + String(_arena.getUploadReceived()) + " bytes");
+    return;
+  }
+
+  if (args.size() == 1 && args[0] == "end") {
+    // Reloading the gait that is walking would change it mid-step - stop
+    // it, but only for a valid upload that replaces that very gait
+    const char* name = nullptr;
+    if (_arena.checkUpload(&name) == GaitFormat::Error::NONE &&
+        (_currentCommand == "run" || (_currentCommand == "transition" && _transitionCommand == "run")) &&
+        _arena.find(name) == _runGait.getSequenceData()) {
+      finishGait();
+    }
+    uint8_t slot = 0;
+    GaitFormat::Error error = _arena.finishUpload(&slot);
+    if (error != GaitFormat::Error::NONE) {
+      _bluetooth.send(String("ERROR: Gait rejected, ") + GaitFormat::errorName(error));
+      return;
+    }
+    const GaitSequenceData* gait = _arena.get(slot);
+    _bluetooth.send(String("OK: Loaded ") + gait->name + " (" + String(gait->stepCount) + " steps)");
+    return;
+  }
+
+  _bluetooth.send("ERROR: Usage: gait-upload <begin <bytes>|data <hex>|end>");
+}
+
+void Robot::handleRunCommand(Args args) {
+  if (args.empty()) {
+    String names;
+    for (uint8_t slot = 0; slot < GaitArena::SLOTS; slot++) {
+      const GaitSequenceData* gait = _arena.get(slot);
+      if (gait != nullptr) {
+        names += String(" ") + gait->name;
+      }
+    }
+    for (uint8_t i = 0; i < _library.getCount(); i++) {
+      names += String(" ") + _library.getName(i);
+    }
+    _bluetooth.send("OK: " + String(_arena.getCount() + _library.getCount()) + " gaits" + names);
+    return;
+  }
+
+  // Uploaded gaits first, so a tuned copy overrides the library's
+  const GaitSequenceData* gait = _arena.find(args[0].c_str());
+  if (gait == nullptr && _library.findBlob(args[0].c_str(), nullptr) != nullptr) {
+    // The library has one active gait at a time - stop the one walking first
+    if (_currentCommand == "run" || (_currentCommand == "transition" && _transitionCommand == "run")) {
+      finishGait();
+    }
+    gait = _library.select(args[0].c_str());
+    if (gait == nullptr) {
+      _bluetooth.send("ERROR: Gait " + args[0] + " in flash is corrupt");
+      return;
+    }
+  }
+  if (gait == nullptr) {
+    _bluetooth.send("ERROR: No gait named " + args[0]);
+    return;
+  }
+
+  Log::debugln("Robot: Executing RUN command (%s)", gait->name);
+  std::vector<String> cycles(args.begin() + 1, args.end());
+  _runGait.setSequenceData(gait);
+  if (startGait(_runGait, "run", cycles)) {
+    _bluetooth.send(String("OK: Running ") + gait->name);
+  }
+}
+
 void Robot::handleWiggleCommand(Args args) {
   if (args.empty()) {
     Log::println("Robot: WIGGLE command missing servo name");
@@ -318,6 +620,259 @@ void Robot::handleWiggleCommand(Args args) {
   }
 }
 
+void Robot::handleCalibrateCommand(Args args) {
+  if (args.empty()) {
+    Log::println("Robot: CALIBRATE command missing servo name");
+    _bluetooth.send("ERROR: Usage: calibrate <servoName> [<min> <mid> <max>]");
+    return;
+  }
+
+  const String& servoName = args[0];
+  ServoCalibration cal;
+
+  if (args.size() == 1) {
+    // Show current calibration
+    if (!_body.getServoCalibration(servoName, cal)) {
+      _bluetooth.send("ERROR: Unknown servo " + servoName);
+      return;
+    }
+    _bluetooth.send("OK: " + servoName +
+                    " min=" + String(cal.minPulse) +
+                    " mid=" + String(cal.midPulse) +
+                    " max=" + String(cal.maxPulse));
+    return;
+  }
+
+  if (args.size() != 4) {
+    _bluetooth.send("ERROR: Usage: calibrate <servoName> [<min> <mid> <max>]");
+    return;
+  }
+
+  Log::println("Robot: Executing CALIBRATE command for '%s'", servoName.c_str());
+  cal.minPulse = args[1].toInt();
+  cal.midPulse = args[2].toInt();
+  cal.maxPulse = args[3].toInt();
+
+  if (!cal.isValid()) {
+    _bluetooth.send("ERROR: Pulses must satisfy min < mid < max < 4096");
+    return;
+  }
+
+  if (!cal.fits(_board.pwmSafeMin(), _board.pwmSafeMax())) {
+    _bluetooth.send("ERROR: Pulses must be within " + String(_board.pwmSafeMin()) +
+                    "-" + String(_board.pwmSafeMax()));
+    return;
+  }
+
+  if (_body.setServoCalibration(servoName, cal)) {
+    _bluetooth.send("OK: Calibrated " + servoName);
+  } else {
+    _bluetooth.send("ERROR: Unknown servo " + servoName);
+  }
+}
+
+void Robot::handleBusBenchCommand(Args args) {
+  Log::println("Robot: Executing BUS-BENCH command");
+
+  // Output task is held off while the benchmark owns the bus
+  BusBenchmark busBench(_bus);
+  _body.getServoOutput().withExclusiveBus([&busBench]() {
+    busBench.run();
+  });
+  busBench.logResults();
+
+  for (uint8_t i = 0; i < BusBenchmark::RATE_COUNT; i++) {
+    const BusRateResult& r = busBench.getResult(i);
+    if (!r.measured) {
+      _bluetooth.send(String("BUS: ") + String(r.clockHz / 1000) + "kHz skipped");
+      continue;
+    }
+    _bluetooth.send(String("BUS: ") + String(r.clockHz / 1000) + "kHz " +
+                    (r.reliable() ? "ok " : "fail ") +
+                    String(r.transactionUs()) + "us/transaction");
+  }
+  _bluetooth.send(String("OK: Bus clock ") + String(busBench.getSelectedClock() / 1000) + "kHz");
+}
+
+void Robot::handleIdleCommand(Args args) {
+  if (args.empty()) {
+    _bluetooth.send(String("OK: Idle release ") + String(_body.getIdleRelease()) + "ms, " +
+                    String(_body.getReleasedLegCount()) + " legs released");
+    return;
+  }
+
+  long timeoutMs = args[0].toInt();
+  if (timeoutMs < 0 || (timeoutMs == 0 && args[0] != "0")) {
+    _bluetooth.send("ERROR: Usage: idle [<ms>] (0 = off)");
+    return;
+  }
+
+  Log::println("Robot: Executing IDLE command (%ld ms)", timeoutMs);
+  _body.setIdleRelease((uint32_t)timeoutMs);
+  _bluetooth.send(String("OK: Idle release ") + String(timeoutMs) + "ms");
+}
+
+void Robot::handleWriteBudgetCommand(Args args) {
+  ServoWriteScheduler& scheduler = _body.getWriteScheduler();
+
+  if (args.empty()) {
+    _bluetooth.send(String("OK: Write budget ") + String(scheduler.getBudget()) + "/frame, " +
+                    String(scheduler.getFrameCount()) + " frames, " +
+                    String(scheduler.getFinalWriteCount()) + " final, " +
+                    String(scheduler.getBudgetWriteCount()) + " budgeted, " +
+                    String(scheduler.getDeferredCount()) + " deferred");
+    return;
+  }
+
+  long writes = args[0].toInt();
+  if (writes < 1 || writes > ServoWriteScheduler::MAX_JOINTS) {
+    _bluetooth.send(String("ERROR: Usage: write-budget [<1-") +
+                    String(ServoWriteScheduler::MAX_JOINTS) + ">]");
+    return;
+  }
+
+  Log::println("Robot: Executing WRITE-BUDGET command (%ld writes/frame)", writes);
+  scheduler.setBudget((uint8_t)writes);
+  scheduler.resetStats();
+  _bluetooth.send(String("OK: Write budget ") + String(writes) + "/frame");
+}
+
+void Robot::handleHysteresisCommand(Args args) {
+  WriteFilterProfiler& profiler = _body.getServoWriteProfiler();
+
+  if (args.empty()) {
+    _bluetooth.send(String("OK: Hysteresis ") + String(_body.getServoHysteresis()) + " ticks, " +
+                    String(profiler.getIssuedWrites()) + " issued, " +
+                    String(profiler.getSuppressedWrites()) + " suppressed, logging " +
+                    (profiler.isEnabled() ? "on" : "off"));
+    return;
+  }
+
+  if (args[0] == "log") {
+    if (args.size() != 2 || (args[1] != "on" && args[1] != "off")) {
+      _bluetooth.send("ERROR: Usage: hysteresis log on|off");
+      return;
+    }
+    profiler.setEnabled(args[1] == "on");
+    _bluetooth.send("OK: Write suppression logging " + args[1]);
+    return;
+  }
+
+  long ticks = args[0].toInt();
+  if (ticks < 0 || ticks > 50 || (ticks == 0 && args[0] != "0")) {
+    _bluetooth.send("ERROR: Usage: hysteresis [<0-50> | log on|off]");
+    return;
+  }
+
+  Log::println("Robot: Executing HYSTERESIS command (%ld ticks)", ticks);
+  _body.setServoHysteresis((uint8_t)ticks);
+  profiler.reset();
+  _bluetooth.send(String("OK: Hysteresis ") + String(ticks) + " ticks");
+}
+
+void Robot::handleFrameRateCommand(Args args) {
+  if (args.empty()) {
+    _bluetooth.send(String("OK: Frame rate ") + String(_frameClock.getRateHz()) + "Hz, " +
+                    String(_frameClock.getFrameCount()) + " frames, " +
+                    String(_frameClock.getOverrunCount()) + " overruns, " +
+                    String(_frameClock.getSkippedFrameCount()) + " skipped");
+    return;
+  }
+
+  // Round to the nearest whole number of refresh periods
+  long hz = args[0].toInt();
+  long refreshHz = _board.pwmFrequency();
+  if (hz < 1 || hz > refreshHz) {
+    _bluetooth.send(String("ERROR: Usage: frame-rate [<1-") + String(refreshHz) + ">]");
+    return;
+  }
+  long periods = (refreshHz + hz / 2) / hz;
+  if (periods > 255) periods = 255;
+
+  Log::println("Robot: Executing FRAME-RATE command (%ld periods/frame)", periods);
+  _frameClock.setPeriodsPerFrame((uint8_t)periods);
+  _frameClock.resetStats();
+  _bluetooth.send(String("OK: Frame rate ") + String(_frameClock.getRateHz()) + "Hz");
+}
+
+void Robot::handleProfileCommand(Args args) {
+  if (args.empty()) {
+    const MotionLimits& limits = _body.getMotionLimits();
+    _bluetooth.send(String("OK: Profile ") + MotionProfile::name(_body.getMotionProfile()) +
+                    ", accel " + String(limits.accel) + "°/s², jerk " + String(limits.jerk) + "°/s³");
+    return;
+  }
+
+  ProfileType type;
+  if (args[0] == "constant") {
+    type = ProfileType::CONSTANT;
+  } else if (args[0] == "trapezoid") {
+    type = ProfileType::TRAPEZOID;
+  } else if (args[0] == "scurve") {
+    type = ProfileType::SCURVE;
+  } else {
+    _bluetooth.send("ERROR: Usage: profile [<constant|trapezoid|scurve> [<accel> [<jerk>]]]");
+    return;
+  }
+
+  MotionLimits limits = _board.servoLimits();
+  if (args.size() > 1) {
+    long accel = args[1].toInt();
+    if (accel < 1) {
+      _bluetooth.send("ERROR: accel must be a positive number of °/s²");
+      return;
+    }
+    limits.accel = (uint32_t)accel;
+  }
+  if (args.size() > 2) {
+    long jerk = args[2].toInt();
+    if (jerk < 1) {
+      _bluetooth.send("ERROR: jerk must be a positive number of °/s³");
+      return;
+    }
+    limits.jerk = (uint32_t)jerk;
+  }
+
+  Log::println("Robot: Executing PROFILE command (%s)", MotionProfile::name(type));
+  _body.setMotionProfile(type, limits);
+  _bluetooth.send(String("OK: Profile ") + MotionProfile::name(type));
+}
+
+void Robot::handleSyncCommand(Args args) {
+  if (args.empty()) {
+    _bluetooth.send(String("OK: Sync ") + (_body.getSynchronizedArrival() ? "on" : "off"));
+    return;
+  }
+
+  if (args[0] != "on" && args[0] != "off") {
+    _bluetooth.send("ERROR: Usage: sync [on|off]");
+    return;
+  }
+
+  bool enabled = args[0] == "on";
+  Log::println("Robot: Executing SYNC command (%s)", enabled ? "on" : "off");
+  _body.setSynchronizedArrival(enabled);
+  _bluetooth.send(String("OK: Sync ") + (enabled ? "on" : "off"));
+}
+
+void Robot::handleBlendCommand(Args args) {
+  if (args.empty()) {
+    _bluetooth.send(String("OK: Blend radius ") +
+                    String(JointMotion::toDegrees(_body.getBlendRadius()), 1) + "°");
+    return;
+  }
+
+  float degrees = args[0].toFloat();
+  if (degrees < 0.0f || degrees > 45.0f) {
+    _bluetooth.send("ERROR: Blend radius must be 0-45°");
+    return;
+  }
+
+  Log::println("Robot: Executing BLEND command (%.1f°)", degrees);
+  _body.setBlendRadius(JointMotion::fromDegrees(degrees));
+  _bluetooth.send(String("OK: Blend radius ") + String(degrees, 1) + "°");
+}
+
 void Robot::handleTestMovementCommand(Args args) {
   if (args.empty()) {
     Log::println("Robot: TEST-MOVEMENT command missing gait name");
@@ -5,9 +5,18 @@
 #include <flasher.h>
 #include <board.h>
 #include <body.h>
+#include <wire_bus.h>
+#include <bus_benchmark.h>
+#include <control_frame_clock.h>
 #include <one_sweep_sequence.h>
 #include <multi_step_gait.h>
 #include <gait_sequences.h>
+#include <gait_transition.h>
+#include <gait_generator.h>
+#include <gait_arena.h>
+#include <gait_library.h>
+#include <phase_gait.h>
+#include <phase_gaits.h>
 #include <command_router.h>
 #include <bluetooth_connection.h>
 #include <profiler.h>
@@ -17,6 +26,7 @@ class Robot {
   private:
     Flasher _flasher;
     Board _board;
+    WireBus _bus;
     Body _body;
     OneSweepSequence _sweep;
     MultiStepGait _stationaryGait;
@@ -25,6 +35,27 @@ class Robot {
     MultiStepGait _leftGait;
     MultiStepGait _rightGait;
 
+    // Keyframes from the current leg state into the next command's gait
+    GaitTransition _transition;
+    MultiStepGait _transitionGait;
+    String _transitionCommand;
+
+    // Walking cycle built from stride, lift, duty factor and period
+    GaitGenerator _generator;
+    MultiStepGait _generatedGait;
+
+    // Gaits uploaded over Bluetooth, the library in the "gaits" flash
+    // partition, and the one "run" is walking
+    GaitArena _arena;
+    GaitLibrary _library;
+    MultiStepGait _runGait;
+
+    // Cyclic gaits with a phase per leg, driven every frame while walking
+    PhaseGait _tripodGait;
+    PhaseGait _rippleGait;
+    PhaseGait _waveGait;
+    PhaseGait* _phaseGait;
+
     // Communication components
     CommandRouter _commandRouter;
     BluetoothConnection _bluetooth;
@@ -35,7 +66,8 @@ class Robot {
     // Test harness for movement testing
     TestHarness _testHarness;
 
-    uint32_t _lastUpdateMs;
+    // Fixed-rate control frames locked to the servo refresh
+    ControlFrameClock _frameClock;
     bool _firstLoop;
 
     // Command state
@@ -53,10 +85,44 @@ class Robot {
     void handleLeftCommand(Args args);
     void handleRightCommand(Args args);
     void handleStopCommand(Args args);
+    void handleWalkCommand(Args args);
+    void handleGaitCommand(Args args);
+    void handleFootCommand(Args args);
+    void handleGaitUploadCommand(Args args);
+    void handleRunCommand(Args args);
     void handleWiggleCommand(Args args);
+    void handleCalibrateCommand(Args args);
+    void handleBusBenchCommand(Args args);
+    void handleIdleCommand(Args args);
+    void handleWriteBudgetCommand(Args args);
+    void handleHysteresisCommand(Args args);
+    void handleFrameRateCommand(Args args);
+    void handleProfileCommand(Args args);
+    void handleSyncCommand(Args args);
+    void handleBlendCommand(Args args);
     void handleTestMovementCommand(Args args);
     void handleDebugCommand(Args args);
 
+    // Gait state machine - advances when Body reports the step is complete
+    void handleMotionComplete();
+
+    // Multi-step gait for the current command, nullptr if none
+    MultiStepGait* activeGait();
+
+    // Start a motion command's gait - continuous, or the cycle count in args
+    // Returns false (after replying with the error) if args are invalid
+    bool startGait(MultiStepGait& gait, const char* command, Args args);
+
+    // Apply the gait's current step, and any following steps it does not wait for
+    void applyGaitSteps(MultiStepGait& gait);
+
+    // A gait ran its last step - hand a transition over to the gait it
+    // leads into, otherwise finishGait()
+    void endGait();
+
+    // Return to the stationary gait and stop updating the body
+    void finishGait();
+
     // Communication setup
     void setupCommands();
 
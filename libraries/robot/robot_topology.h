@@ -0,0 +1,102 @@
+#ifndef ROBOT_TOPOLOGY_H
+#define ROBOT_TOPOLOGY_H
+
+#include <stdint.h>
+
+/*
+ * Compile-time description of how servos are wired.
+ *
+ * Build flags (e.g. --build-property "compiler.cpp.extra_flags=-DROBOT_LEG_DOF=3"):
+ *   ROBOT_LEG_DOF      2 = shoulder + knee (default, 12 servos)
+ *                      3 = coxa/femur/tibia as shoulder + knee + tibia (18 servos)
+ *   ROBOT_PWM_DRIVERS  Number of PCA9685 boards. Left legs go on the first,
+ *                      right legs on the second. Defaults to 1 for 12
+ *                      servos and 2 for 18 (one board has only 16 channels).
+ *
+ * Servo index = leg * JOINTS_PER_LEG + joint, with legs in the order
+ * LF, LM, LR, RF, RM, RR and joints in the order shoulder, knee, tibia.
+ * Everything sized by servo count (Leg, LegMovement, ServoFrame, calibration)
+ * is derived from here.
+ */
+
+#ifndef ROBOT_LEG_DOF
+#define ROBOT_LEG_DOF 2
+#endif
+
+#ifndef ROBOT_PWM_DRIVERS
+#if ROBOT_LEG_DOF == 3
+#define ROBOT_PWM_DRIVERS 2
+#else
+#define ROBOT_PWM_DRIVERS 1
+#endif
+#endif
+
+#if ROBOT_LEG_DOF != 2 && ROBOT_LEG_DOF != 3
+#error "ROBOT_LEG_DOF must be 2 or 3"
+#endif
+
+#if ROBOT_PWM_DRIVERS != 1 && ROBOT_PWM_DRIVERS != 2
+#error "ROBOT_PWM_DRIVERS must be 1 or 2"
+#endif
+
+namespace Topology {
+
+  static const uint8_t LEG_COUNT = 6;
+  static const uint8_t JOINTS_PER_LEG = ROBOT_LEG_DOF;
+  static const uint8_t SERVO_COUNT = LEG_COUNT * JOINTS_PER_LEG;
+
+  // Joint slots within a leg
+  static const uint8_t SHOULDER = 0;
+  static const uint8_t KNEE = 1;
+  static const uint8_t TIBIA = 2;  // 3-DOF only
+
+  // PCA9685 boards on the bus
+  static const uint8_t DRIVER_COUNT = ROBOT_PWM_DRIVERS;
+  static const uint8_t CHANNELS_PER_DRIVER = 16;
+  static const uint8_t DRIVER_ADDRESSES[DRIVER_COUNT] = {
+    0x40,
+#if ROBOT_PWM_DRIVERS == 2
+    0x41   // A0 bridged
+#endif
+  };
+
+  // Legs per driver (all six on one board, or left / right sides split)
+  static const uint8_t LEGS_PER_DRIVER = LEG_COUNT / DRIVER_COUNT;
+
+  static_assert(LEGS_PER_DRIVER * JOINTS_PER_LEG <= CHANNELS_PER_DRIVER,
+                "Servo layout needs more channels than the PWM drivers have");
+
+  // Short names for logging, indexed by leg and joint slot
+  static const char* const LEG_NAMES[LEG_COUNT] = { "LF", "LM", "LR", "RF", "RM", "RR" };
+  static const char* const JOINT_NAMES[3] = { "shoulder", "knee", "tibia" };
+
+  // Where a servo is wired: which board, which channel on that board
+  struct ServoChannel {
+    uint8_t driver;
+    uint8_t channel;
+  };
+
+  constexpr uint8_t servoIndex(uint8_t leg, uint8_t joint) {
+    return leg * JOINTS_PER_LEG + joint;
+  }
+
+  constexpr uint8_t legOf(uint8_t servo) {
+    return servo / JOINTS_PER_LEG;
+  }
+
+  constexpr uint8_t jointOf(uint8_t servo) {
+    return servo % JOINTS_PER_LEG;
+  }
+
+  // Channels are consecutive per board: each leg takes JOINTS_PER_LEG
+  // channels in joint order (12 servos on one board = channels 0-11)
+  constexpr ServoChannel channelOf(uint8_t servo) {
+    return {
+      (uint8_t)(legOf(servo) / LEGS_PER_DRIVER),
+      (uint8_t)((legOf(servo) % LEGS_PER_DRIVER) * JOINTS_PER_LEG + jointOf(servo))
+    };
+  }
+
+}
+
+#endif
@@ -1,54 +1,73 @@
 #include <servo.h>
-#include <logging.h>
 
-#include <Wire.h>
-#include <Adafruit_PWMServoDriver.h>
+Servo::Servo(Board &board, ServoFrame &frame, uint8_t servonum)
+  : _board(board), _frame(frame), _servonum(servonum) {
+  calibrate(board.defaultCalibration());
+}
 
-// Global PWM driver - matches Adafruit example pattern
-static Adafruit_PWMServoDriver pwm = Adafruit_PWMServoDriver();
+void Servo::begin() {
+  // Always stage initial position for this servo
+  write(_table.toPWM(_position));
+}
 
-// Static flag to track PWM initialization
-bool Servo::_pwmInitialized = false;
+void Servo::calibrate(const ServoCalibration& cal) {
+  _table.build(cal, _board.pwmSafeMin(), _board.pwmSafeMax());
 
-Servo::Servo(Board &board, uint8_t servonum)
-  : _board(board), _servonum(servonum), _positionAngle(90.0f) {}
+  if (_lastPwm != PWM_NONE && !_released) {
+    write(_table.toPWM(_position));
+  }
+}
 
-float Servo::getPosition() {
-  return _positionAngle;
+void Servo::release() {
+  if (_released) {
+    return;
+  }
+  write(Pca9685::FULL_OFF);
+  _released = true;
 }
 
-void Servo::initializePWM(Board& board) {
-  // Single-threaded check-and-initialize pattern
-  // See docs/adr/001-servo-pwm-initialization-thread-safety.md for threading model assumptions
-  if (_pwmInitialized) {
-    return; // Already initialized
+void Servo::engage() {
+  if (!_released) {
+    return;
   }
+  // Last angle is still known - pick up exactly where the servo was left
+  write(_table.toPWM(_position));
+}
 
-  // ESP32: Initialize I2C with custom pins
-  Wire.begin(board.pwmSDA(), board.pwmSCL());
+void Servo::move(AngleQ8 angle, bool force) {
+  _position = angle;
 
-  // Initialize PWM driver (matches Adafruit example)
-  pwm.begin();
-  pwm.setOscillatorFrequency(27000000);  // Calibrate oscillator
-  pwm.setPWMFreq(50);  // 50 Hz for servos (was 60)
+  // Convert angle to PWM and stage it - Body flushes the frame once per tick
+  uint16_t pwm_value = _table.toPWM(angle);
 
-  _pwmInitialized = true;
-  Log::println("Servo: PWM driver initialized");
-}
+  if (_lastPwm != PWM_NONE) {
+    uint16_t change = (pwm_value > _lastPwm) ? pwm_value - _lastPwm : _lastPwm - pwm_value;
+    uint8_t band = force ? 0 : _hysteresis;
+    if (change <= band) {
+      _frame.getWriteProfiler().recordSuppressed();
+      return;  // Same quantized output - nothing to send
+    }
+  }
 
-void Servo::begin() {
-  // Set initial position for this servo
-  uint16_t pwm_value = _board.angleToPWM(_servonum, _positionAngle);
-  pwm.setPWM(_servonum, 0, pwm_value);
+  write(pwm_value);
+  // Note: Blocking delay removed - write rate is now bounded per frame by
+  // ServoWriteScheduler to prevent servo spinning while allowing smooth movement
 }
 
-void Servo::move(float angle) {
-  _positionAngle = angle;
-
-  // Convert angle to PWM for hardware
-  uint16_t pwm_value = _board.angleToPWM(_servonum, angle);
-  pwm.setPWM(_servonum, 0, pwm_value);
-  // Note: Blocking delay removed - rate limiting now handled by Joint class
-  // via CallRateProfiler to prevent servo spinning while allowing smooth movement
+uint16_t Servo::pendingChange(AngleQ8 angle) const {
+  if (_released) {
+    return 0;  // Held off on purpose - Leg::engage() brings it back
+  }
+  if (_lastPwm == PWM_NONE) {
+    return PWM_NONE;
+  }
+  uint16_t pwm_value = _table.toPWM(angle);
+  return (pwm_value > _lastPwm) ? pwm_value - _lastPwm : _lastPwm - pwm_value;
 }
 
+void Servo::write(uint16_t pwm) {
+  _released = false;
+  _lastPwm = pwm;
+  _frame.set(_servonum, pwm);
+  _frame.getWriteProfiler().recordIssued();
+}
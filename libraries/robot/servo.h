@@ -3,34 +3,75 @@
 
 #include <stdint.h>
 #include <board.h>
+#include <servo_frame.h>
+#include <servo_calibration.h>
 
 /*
- * Simple abstraction of servo library
+ * One servo channel.
+ *
+ * Converts angles to PWM through a per-servo calibrated lookup table
+ * and stages them in the shared ServoFrame.
+ * Nothing is sent over I2C here - Body flushes the frame once per tick.
+ *
+ * The last PWM value written is remembered so that moves which quantize
+ * to the same (or, with hysteresis, a nearby) PWM count cause no bus
+ * traffic at all.
  */
 class Servo {
   private:
 
+    static const uint16_t PWM_NONE = 0xFFFF;  // Nothing written yet
+
     Board& _board;
+    ServoFrame& _frame;
 
     uint8_t _servonum = 0;
-    float _positionAngle = 90.0f;  // Start at middle (90 degrees)
+    AngleQ8 _position = JointMotion::degrees(90);  // Start at middle (90 degrees)
 
-    // PWM initialization flag - safe for single-threaded Arduino model
-    // WARNING: Add synchronization if using FreeRTOS tasks or multi-core execution
-    // See docs/adr/001-servo-pwm-initialization-thread-safety.md
-    static bool _pwmInitialized;
+    uint16_t _lastPwm = PWM_NONE;  // Last PWM value staged for output
+    uint8_t _hysteresis = 0;       // Ignore changes of this many ticks or fewer
+    bool _released = false;        // Output switched to full-off
 
-  public:
+    ServoAngleTable _table;        // Calibrated angle -> PWM lookup
+
+    void write(uint16_t pwm);
 
-    Servo(Board& board, uint8_t servonum);
+  public:
 
-    // Initialize PWM driver (call once before any servo operations)
-    static void initializePWM(Board& board);
+    Servo(Board& board, ServoFrame& frame, uint8_t servonum);
 
     void begin();
-    void move(float angle);
-    float getPosition();
+
+    // Rebuild the angle -> PWM table; re-sends the current position
+    // if the servo is already running
+    void calibrate(const ServoCalibration& cal);
+    uint16_t angleToPWM(AngleQ8 angle) const { return _table.toPWM(angle); }
+
+    // Move to angle. Unchanged PWM values are suppressed; changes within
+    // the hysteresis band are also suppressed unless force is set (used
+    // for final positions so a joint always lands exactly on target).
+    void move(AngleQ8 angle, bool force = false);
+
+    // Move to an angle in degrees (commands and diagnostics)
+    void moveDegrees(float angle) { move(JointMotion::fromDegrees(angle)); }
+
+    AngleQ8 getPosition() const { return _position; }
     uint8_t getServoNum() const { return _servonum; }
+
+    // PWM ticks between angle and the last value written (0 while released,
+    // PWM_NONE if nothing has been written yet)
+    uint16_t pendingChange(AngleQ8 angle) const;
+
+    // Stop sending pulses (PCA9685 full-off) - the servo goes limp and
+    // draws no holding current. engage() re-sends the last angle; any
+    // move() also re-energizes the servo.
+    void release();
+    void engage();
+    bool isReleased() const { return _released; }
+
+    // Hysteresis band in PWM ticks (0 = only suppress identical values)
+    void setHysteresis(uint8_t ticks) { _hysteresis = ticks; }
+    uint8_t getHysteresis() const { return _hysteresis; }
 };
 
 #endif
@@ -0,0 +1,121 @@
+#include <servo_calibration.h>
+#include <logging.h>
+#include <Preferences.h>
+
+#define CALIBRATION_NAMESPACE "servo-cal"
+#define CALIBRATION_KEY "servos"
+
+// ============================================================================
+// ServoAngleTable Implementation
+// ============================================================================
+
+ServoAngleTable::ServoAngleTable() {
+  for (uint8_t i = 0; i < ENTRIES; i++) {
+    _pwm[i] = 0;
+  }
+}
+
+void ServoAngleTable::build(const ServoCalibration& cal, uint16_t minSafe, uint16_t maxSafe) {
+  for (uint8_t degree = 0; degree < ENTRIES; degree++) {
+    // Piecewise linear through min (0°), mid (90°) and max (180°), rounded
+    int32_t pwm;
+    if (degree <= 90) {
+      pwm = cal.minPulse + ((int32_t)(cal.midPulse - cal.minPulse) * degree + 45) / 90;
+    } else {
+      pwm = cal.midPulse + ((int32_t)(cal.maxPulse - cal.midPulse) * (degree - 90) + 45) / 90;
+    }
+
+    // Safety clamp to prevent extreme positions
+    if (pwm < minSafe) pwm = minSafe;
+    if (pwm > maxSafe) pwm = maxSafe;
+    _pwm[degree] = (uint16_t)pwm;
+  }
+}
+
+uint16_t ServoAngleTable::toPWM(AngleQ8 angle) const {
+  // Whole degree indexes the table, fraction interpolates towards the next entry
+  if (angle >= (ENTRIES - 1) << 8) return _pwm[ENTRIES - 1];
+
+  uint8_t degree = angle >> 8;
+  int32_t fraction = angle & 0xFF;
+  int32_t step = (int32_t)_pwm[degree + 1] - (int32_t)_pwm[degree];
+  return _pwm[degree] + ((step * fraction) >> 8);
+}
+
+// ============================================================================
+// ServoCalibrationStore Implementation
+// ============================================================================
+
+ServoCalibrationStore::ServoCalibrationStore()
+  : _minSafe(0),
+    _maxSafe(4095) {
+  _record.version = VERSION;
+  _record.servoCount = SERVO_COUNT;
+  setDefaults({0, 0, 0});
+}
+
+void ServoCalibrationStore::setDefaults(const ServoCalibration& cal) {
+  for (uint8_t i = 0; i < SERVO_COUNT; i++) {
+    _record.servos[i] = cal;
+  }
+}
+
+void ServoCalibrationStore::setSafeRange(uint16_t minSafe, uint16_t maxSafe) {
+  _minSafe = minSafe;
+  _maxSafe = maxSafe;
+}
+
+bool ServoCalibrationStore::load() {
+  Preferences prefs;
+  if (!prefs.begin(CALIBRATION_NAMESPACE, true)) {
+    return false;
+  }
+
+  Record stored;
+  bool ok = prefs.getBytesLength(CALIBRATION_KEY) == sizeof(stored) &&
+            prefs.getBytes(CALIBRATION_KEY, &stored, sizeof(stored)) == sizeof(stored) &&
+            stored.version == VERSION &&
+            stored.servoCount == SERVO_COUNT;
+  prefs.end();
+
+  if (!ok) {
+    Log::println("Calibration: none stored, using defaults");
+    return false;
+  }
+
+  // Take each servo individually so one corrupt entry keeps its default
+  for (uint8_t i = 0; i < SERVO_COUNT; i++) {
+    if (stored.servos[i].isValid() && stored.servos[i].fits(_minSafe, _maxSafe)) {
+      _record.servos[i] = stored.servos[i];
+    }
+  }
+  Log::println("Calibration: loaded %d servos from NVS", SERVO_COUNT);
+  return true;
+}
+
+bool ServoCalibrationStore::save() {
+  Preferences prefs;
+  if (!prefs.begin(CALIBRATION_NAMESPACE, false)) {
+    Log::println("Calibration: NVS unavailable");
+    return false;
+  }
+
+  bool ok = prefs.putBytes(CALIBRATION_KEY, &_record, sizeof(_record)) == sizeof(_record);
+  prefs.end();
+
+  Log::println("Calibration: %s", ok ? "saved to NVS" : "save failed");
+  return ok;
+}
+
+const ServoCalibration& ServoCalibrationStore::get(uint8_t servoNum) const {
+  if (servoNum >= SERVO_COUNT) servoNum = 0;
+  return _record.servos[servoNum];
+}
+
+bool ServoCalibrationStore::set(uint8_t servoNum, const ServoCalibration& cal) {
+  if (servoNum >= SERVO_COUNT || !cal.isValid() || !cal.fits(_minSafe, _maxSafe)) {
+    return false;
+  }
+  _record.servos[servoNum] = cal;
+  return true;
+}
@@ -0,0 +1,102 @@
+#ifndef SERVO_CALIBRATION_H
+#define SERVO_CALIBRATION_H
+
+#include <stdint.h>
+#include <robot_topology.h>
+#include <joint_motion.h>
+
+/*
+ * Pulse widths (PCA9685 ticks) that put one servo at 0°, 90° and 180°.
+ *
+ * Two linear segments (min→mid, mid→max) capture servos whose travel
+ * is not symmetric about the middle, which a single offset cannot.
+ */
+struct ServoCalibration {
+  uint16_t minPulse;  // PWM ticks at 0°
+  uint16_t midPulse;  // PWM ticks at 90°
+  uint16_t maxPulse;  // PWM ticks at 180°
+
+  // Pulses must be strictly increasing and fit the 12-bit PWM counter
+  bool isValid() const {
+    return minPulse < midPulse && midPulse < maxPulse && maxPulse < 4096;
+  }
+
+  // Every pulse lies within the board's safe range
+  bool fits(uint16_t minSafe, uint16_t maxSafe) const {
+    return minPulse >= minSafe && maxPulse <= maxSafe;
+  }
+};
+
+/*
+ * Precomputed angle → PWM table for one servo.
+ *
+ * Built once from a ServoCalibration; converting a Q8.8 angle is then a
+ * table read at (angle >> 8) plus an integer interpolation on the low
+ * byte, with no float math on the servo write path.
+ */
+class ServoAngleTable {
+  public:
+    static const uint8_t ENTRIES = 181;  // 0..180 degrees inclusive
+
+  private:
+    uint16_t _pwm[ENTRIES];
+
+  public:
+    ServoAngleTable();
+
+    // Rebuild the table from calibration, limited to [minSafe, maxSafe] ticks
+    void build(const ServoCalibration& cal, uint16_t minSafe, uint16_t maxSafe);
+
+    // PWM ticks for a Q8.8 angle (clamped to 0-180 degrees)
+    uint16_t toPWM(AngleQ8 angle) const;
+
+    // PWM ticks at a whole degree
+    uint16_t at(uint8_t degree) const { return _pwm[degree < ENTRIES ? degree : ENTRIES - 1]; }
+};
+
+/*
+ * Calibration for all servos persisted in NVS (ESP32 Preferences).
+ *
+ * Falls back to the board defaults when nothing has been stored yet or
+ * the stored record does not match the current layout. User-entered and
+ * stored calibrations outside the safe pulse range are refused.
+ */
+class ServoCalibrationStore {
+  public:
+    static const uint8_t SERVO_COUNT = Topology::SERVO_COUNT;
+
+  private:
+    static const uint8_t VERSION = 1;
+
+    struct Record {
+      uint8_t version;
+      uint8_t servoCount;
+      ServoCalibration servos[SERVO_COUNT];
+    };
+
+    Record _record;
+    uint16_t _minSafe;
+    uint16_t _maxSafe;
+
+  public:
+    ServoCalibrationStore();
+
+    // Reset every servo to the given calibration (in RAM only)
+    void setDefaults(const ServoCalibration& cal);
+
+    // Pulse range set() and load() accept (default: the whole 12-bit range)
+    void setSafeRange(uint16_t minSafe, uint16_t maxSafe);
+
+    // Load from NVS; returns false (and keeps defaults) if nothing valid is stored
+    bool load();
+
+    // Write current calibration to NVS
+    bool save();
+
+    const ServoCalibration& get(uint8_t servoNum) const;
+
+    // False if servoNum is out of range or cal is invalid or not within the safe range
+    bool set(uint8_t servoNum, const ServoCalibration& cal);
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include <servo_frame.h>
+
+ServoFrame::ServoFrame()
+  : _writeProfiler("ServoWrites", false, 1000) {
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    for (uint8_t ch = 0; ch < Topology::CHANNELS_PER_DRIVER; ch++) {
+      _pwm[d][ch] = 0;
+    }
+    clearDirty(d);
+  }
+}
+
+void ServoFrame::clearDirty(uint8_t driver) {
+  _dirtyFirst[driver] = Topology::CHANNELS_PER_DRIVER;
+  _dirtyLast[driver] = 0;
+}
+
+void ServoFrame::set(uint8_t servo, uint16_t pwm) {
+  if (servo >= SERVO_COUNT) return;
+  Topology::ServoChannel out = Topology::channelOf(servo);
+  _pwm[out.driver][out.channel] = pwm;
+
+  // Grow the driver's dirty span to cover this channel
+  if (out.channel < _dirtyFirst[out.driver]) _dirtyFirst[out.driver] = out.channel;
+  if (out.channel > _dirtyLast[out.driver]) _dirtyLast[out.driver] = out.channel;
+}
+
+uint16_t ServoFrame::get(uint8_t servo) const {
+  if (servo >= SERVO_COUNT) return 0;
+  Topology::ServoChannel out = Topology::channelOf(servo);
+  return _pwm[out.driver][out.channel];
+}
+
+bool ServoFrame::isDirty() const {
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    if (isDirty(d)) return true;
+  }
+  return false;
+}
+
+bool ServoFrame::flush(Pca9685* drivers) {
+  bool sent = false;
+
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    if (!isDirty(d)) {
+      continue;  // Nothing changed on this board - no bus traffic
+    }
+
+    // One burst covering every changed channel (unchanged channels inside
+    // the span are rewritten with their current value, which is harmless)
+    uint8_t first = _dirtyFirst[d];
+    drivers[d].writeChannels(first, &_pwm[d][first], _dirtyLast[d] - first + 1);
+    clearDirty(d);
+    sent = true;
+  }
+  return sent;
+}
+
+void ServoFrame::takeChanges(ServoFrame& staged) {
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    if (!staged.isDirty(d)) {
+      continue;
+    }
+
+    // All values are copied so channels inside a merged span stay current
+    for (uint8_t ch = 0; ch < Topology::CHANNELS_PER_DRIVER; ch++) {
+      _pwm[d][ch] = staged._pwm[d][ch];
+    }
+    if (staged._dirtyFirst[d] < _dirtyFirst[d]) _dirtyFirst[d] = staged._dirtyFirst[d];
+    if (staged._dirtyLast[d] > _dirtyLast[d]) _dirtyLast[d] = staged._dirtyLast[d];
+
+    staged.clearDirty(d);
+  }
+}
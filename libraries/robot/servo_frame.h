@@ -0,0 +1,58 @@
+#ifndef SERVO_FRAME_H
+#define SERVO_FRAME_H
+
+#include <stdint.h>
+#include <pca9685.h>
+#include <profiler.h>
+#include <robot_topology.h>
+
+/*
+ * PWM values for every servo in one control tick.
+ *
+ * Servos stage their values here during Body::update() and the frame is
+ * flushed once at the end of the tick as a single auto-increment burst
+ * per PCA9685, instead of one I2C transaction per servo. Servo indices are
+ * mapped to (driver, channel) by the topology; only the span of channels
+ * that changed on each driver since the last flush is sent.
+ */
+class ServoFrame {
+  public:
+    static const uint8_t SERVO_COUNT = Topology::SERVO_COUNT;
+
+  private:
+    uint16_t _pwm[Topology::DRIVER_COUNT][Topology::CHANNELS_PER_DRIVER];
+
+    // Lowest and highest channel staged on each driver since the last flush
+    // (first > last means nothing to send)
+    uint8_t _dirtyFirst[Topology::DRIVER_COUNT];
+    uint8_t _dirtyLast[Topology::DRIVER_COUNT];
+
+    // Issued vs suppressed servo writes (fed by Servo::move)
+    WriteFilterProfiler _writeProfiler;
+
+    void clearDirty(uint8_t driver);
+    bool isDirty(uint8_t driver) const { return _dirtyFirst[driver] <= _dirtyLast[driver]; }
+
+  public:
+    ServoFrame();
+
+    // Stage a PWM value for a servo (sent on next flush)
+    void set(uint8_t servo, uint16_t pwm);
+    uint16_t get(uint8_t servo) const;
+
+    // True if any servo was staged since the last flush
+    bool isDirty() const;
+
+    // Send the changed channels, one burst per driver that changed
+    // drivers: array of Topology::DRIVER_COUNT, in DRIVER_ADDRESSES order
+    // Returns true if any transaction was issued
+    bool flush(Pca9685* drivers);
+
+    // Take all values and the changed spans from a staging frame, adding
+    // to any changes not yet flushed here. The staging frame is left clean.
+    void takeChanges(ServoFrame& staged);
+
+    WriteFilterProfiler& getWriteProfiler() { return _writeProfiler; }
+};
+
+#endif
@@ -0,0 +1,221 @@
+#include <servo_output_task.h>
+#include <logging.h>
+
+ServoOutputTask::ServoOutputTask(II2cBus& bus)
+  : _drivers{
+      Pca9685(bus, Topology::DRIVER_ADDRESSES[0])
+#if ROBOT_PWM_DRIVERS == 2
+      , Pca9685(bus, Topology::DRIVER_ADDRESSES[1])
+#endif
+    },
+    _back(0),
+    _pending(false),
+    _running(false),
+    _published(0),
+    _sent(0),
+    _merged(0)
+#if defined(ESP32)
+    , _task(nullptr),
+    _mutex(nullptr),
+    _busMutex(nullptr)
+#endif
+{
+}
+
+ServoOutputTask::~ServoOutputTask() {
+  end();
+}
+
+bool ServoOutputTask::begin() {
+  if (_running) {
+    return true;
+  }
+
+  // Drivers are initialized here, before the task exists - from then on
+  // only the task touches them, so no further synchronization is needed
+  bool ok = true;
+  for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+    if (!_drivers[d].begin()) {
+      Log::println("ServoOutput: no PCA9685 at 0x%02X", _drivers[d].getAddress());
+      ok = false;
+    }
+  }
+  _running = true;
+
+#if defined(ESP32)
+  _mutex = xSemaphoreCreateMutexStatic(&_mutexBuffer);
+  _busMutex = xSemaphoreCreateMutexStatic(&_busMutexBuffer);
+  _task = xTaskCreateStaticPinnedToCore(taskEntry, "servo-out", STACK_SIZE, this,
+                                        PRIORITY, _stack, &_taskBuffer, CORE);
+#else
+  _thread = std::thread([this]() { run(); });
+#endif
+
+  Log::println("ServoOutput: task started");
+  return ok;
+}
+
+void ServoOutputTask::end() {
+  if (!_running) {
+    return;
+  }
+
+  lock();
+  _running = false;
+  unlock();
+
+#if defined(ESP32)
+  xTaskNotifyGive(_task);
+#else
+  _wake.notify_one();
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+#endif
+}
+
+#if defined(ESP32)
+void ServoOutputTask::taskEntry(void* self) {
+  static_cast<ServoOutputTask*>(self)->run();
+  vTaskDelete(nullptr);
+}
+
+void ServoOutputTask::lock() {
+  if (_mutex != nullptr) {  // Not created until begin()
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+  }
+}
+
+void ServoOutputTask::unlock() {
+  if (_mutex != nullptr) {
+    xSemaphoreGive(_mutex);
+  }
+}
+
+void ServoOutputTask::lockBus() {
+  if (_busMutex != nullptr) {
+    xSemaphoreTake(_busMutex, portMAX_DELAY);
+  }
+}
+
+void ServoOutputTask::unlockBus() {
+  if (_busMutex != nullptr) {
+    xSemaphoreGive(_busMutex);
+  }
+}
+
+ServoFrame* ServoOutputTask::waitForFrame() {
+  for (;;) {
+    lock();
+    if (!_running) {
+      unlock();
+      return nullptr;
+    }
+    if (_pending) {
+      // Swap: task takes the collected frame, publishes go to the other one
+      ServoFrame* frame = &_buffers[_back];
+      _back ^= 1;
+      _pending = false;
+      unlock();
+      return frame;
+    }
+    unlock();
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+#else
+void ServoOutputTask::lock() {
+  _mutex.lock();
+}
+
+void ServoOutputTask::unlock() {
+  _mutex.unlock();
+}
+
+void ServoOutputTask::lockBus() {
+  _busMutex.lock();
+}
+
+void ServoOutputTask::unlockBus() {
+  _busMutex.unlock();
+}
+
+ServoFrame* ServoOutputTask::waitForFrame() {
+  std::unique_lock<std::mutex> guard(_mutex);
+  _wake.wait(guard, [this]() { return _pending || !_running; });
+  if (!_running) {
+    return nullptr;
+  }
+
+  // Swap: task takes the collected frame, publishes go to the other one
+  ServoFrame* frame = &_buffers[_back];
+  _back ^= 1;
+  _pending = false;
+  return frame;
+}
+#endif
+
+void ServoOutputTask::run() {
+  // Note: no logging in here - Log's shared buffer is not thread safe
+  ServoFrame* frame;
+  while ((frame = waitForFrame()) != nullptr) {
+    lockBus();
+    frame->flush(_drivers);
+    unlockBus();
+
+    lock();
+    _sent++;
+    unlock();
+  }
+}
+
+void ServoOutputTask::publish(ServoFrame& staged) {
+  if (!staged.isDirty()) {
+    return;  // Nothing changed - don't wake the task
+  }
+
+  lock();
+  if (_pending) {
+    _merged++;  // Task hasn't taken the previous frame yet - combine them
+  }
+  _buffers[_back].takeChanges(staged);
+  _pending = true;
+  _published++;
+  unlock();
+
+#if defined(ESP32)
+  if (_task != nullptr) {
+    xTaskNotifyGive(_task);
+  }
+#else
+  _wake.notify_one();
+#endif
+}
+
+uint32_t ServoOutputTask::getPublishedCount() {
+  lock();
+  uint32_t count = _published;
+  unlock();
+  return count;
+}
+
+uint32_t ServoOutputTask::getSentCount() {
+  lock();
+  uint32_t count = _sent;
+  unlock();
+  return count;
+}
+
+uint32_t ServoOutputTask::getMergedCount() {
+  lock();
+  uint32_t count = _merged;
+  unlock();
+  return count;
+}
+
+bool ServoOutputTask::isIdle() {
+  lock();
+  bool idle = !_pending && (_sent + _merged == _published);
+  unlock();
+  return idle;
+}
@@ -0,0 +1,119 @@
+#ifndef SERVO_OUTPUT_TASK_H
+#define SERVO_OUTPUT_TASK_H
+
+#include <stdint.h>
+#include <i_i2c_bus.h>
+#include <pca9685.h>
+#include <servo_frame.h>
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#else
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+/*
+ * Background task that owns the PCA9685 boards and does all servo I2C output.
+ *
+ * The control loop publishes complete frames into a double buffer and
+ * returns immediately; the task wakes up, takes the most recent frame
+ * and sends it. If the loop publishes faster than the bus can keep up,
+ * intermediate frames are merged so the latest values always win and no
+ * changed channel is lost.
+ *
+ * On the ESP32 this is a statically allocated FreeRTOS task; on the host
+ * a std::thread stands in so the handoff can be tested without hardware.
+ * See docs/adr/005-servo-output-task.md.
+ */
+class ServoOutputTask {
+  public:
+#if defined(ESP32)
+    static const uint32_t STACK_SIZE = 3072;
+    static const UBaseType_t PRIORITY = 2;  // Above loopTask (1)
+    static const BaseType_t CORE = 0;       // Off the loop's core
+#endif
+
+  private:
+    // One driver per board in the topology (all on the same bus)
+    Pca9685 _drivers[Topology::DRIVER_COUNT];
+
+    // Double buffer: _buffers[_back] collects published changes,
+    // the other buffer is the one the task is sending
+    ServoFrame _buffers[2];
+    uint8_t _back;
+    bool _pending;
+    bool _running;
+
+    // Statistics (guarded by the lock)
+    uint32_t _published;
+    uint32_t _sent;
+    uint32_t _merged;
+
+#if defined(ESP32)
+    StaticTask_t _taskBuffer;
+    StackType_t _stack[STACK_SIZE];
+    TaskHandle_t _task;
+    StaticSemaphore_t _mutexBuffer;
+    SemaphoreHandle_t _mutex;
+    StaticSemaphore_t _busMutexBuffer;
+    SemaphoreHandle_t _busMutex;
+
+    static void taskEntry(void* self);
+#else
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::mutex _busMutex;
+#endif
+
+    // Buffer/statistics lock
+    void lock();
+    void unlock();
+
+    // Held by the task while it sends, and by withExclusiveBus()
+    void lockBus();
+    void unlockBus();
+
+    // Block until a frame is pending (or stop requested), then take it
+    // Returns the buffer to send, or nullptr when stopping
+    ServoFrame* waitForFrame();
+
+    void run();
+
+  public:
+    ServoOutputTask(II2cBus& bus);
+    ~ServoOutputTask();
+
+    // Initialize the drivers on the calling thread, then start the task
+    bool begin();
+
+    // Stop the task (host tests; never called on the robot)
+    void end();
+
+    // Hand the staged changes to the task; staged frame is left clean.
+    // Never blocks on the bus.
+    void publish(ServoFrame& staged);
+
+    // Run fn with the bus to itself (e.g. a benchmark) - waits for any
+    // frame in flight, and holds off the task until fn returns
+    template<typename Fn>
+    void withExclusiveBus(Fn fn) {
+      lockBus();
+      fn();
+      unlockBus();
+    }
+
+    // Statistics
+    uint32_t getPublishedCount();
+    uint32_t getSentCount();
+    uint32_t getMergedCount();
+
+    // True once every published frame has been sent
+    bool isIdle();
+};
+
+#endif
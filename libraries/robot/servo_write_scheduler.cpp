@@ -0,0 +1,79 @@
+#include <servo_write_scheduler.h>
+
+ServoWriteScheduler::ServoWriteScheduler(uint8_t budget)
+  : _jointCount(0),
+    _budget(budget > 0 ? budget : 1),
+    _frames(0),
+    _finalWrites(0),
+    _budgetWrites(0),
+    _deferred(0) {
+}
+
+void ServoWriteScheduler::add(Joint& joint) {
+  if (_jointCount < MAX_JOINTS) {
+    _joints[_jointCount++] = &joint;
+  }
+}
+
+void ServoWriteScheduler::setBudget(uint8_t writes) {
+  _budget = writes > 0 ? writes : 1;
+}
+
+uint8_t ServoWriteScheduler::schedule() {
+  // Moving joints that want a write, with their error in PWM ticks
+  uint8_t candidates[MAX_JOINTS];
+  uint16_t errors[MAX_JOINTS];
+  uint8_t candidateCount = 0;
+  uint8_t written = 0;
+
+  _frames++;
+
+  for (uint8_t i = 0; i < _jointCount; i++) {
+    Joint& joint = *_joints[i];
+    Servo& servo = joint.getServo();
+    uint16_t error = servo.pendingChange(joint.getPosition());
+    if (error == 0) {
+      continue;  // Servo already shows this position (or is released)
+    }
+
+    if (joint.atTarget()) {
+      // Final position - always written, exactly
+      servo.move(joint.getPosition(), true);
+      _finalWrites++;
+      written++;
+    } else if (error > servo.getHysteresis()) {
+      candidates[candidateCount] = i;
+      errors[candidateCount] = error;
+      candidateCount++;
+    }
+  }
+
+  // Spend what is left of the budget on the largest errors
+  // (selection sort over at most MAX_JOINTS entries)
+  uint8_t remaining = (_budget > written) ? _budget - written : 0;
+  uint8_t picks = (remaining < candidateCount) ? remaining : candidateCount;
+  for (uint8_t p = 0; p < picks; p++) {
+    uint8_t best = p;
+    for (uint8_t c = p + 1; c < candidateCount; c++) {
+      if (errors[c] > errors[best]) best = c;
+    }
+    uint8_t index = candidates[best];
+    candidates[best] = candidates[p];
+    errors[best] = errors[p];
+
+    Joint& joint = *_joints[index];
+    joint.getServo().move(joint.getPosition());
+    _budgetWrites++;
+    written++;
+  }
+  _deferred += candidateCount - picks;
+
+  return written;
+}
+
+void ServoWriteScheduler::resetStats() {
+  _frames = 0;
+  _finalWrites = 0;
+  _budgetWrites = 0;
+  _deferred = 0;
+}
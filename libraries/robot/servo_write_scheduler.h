@@ -0,0 +1,58 @@
+#ifndef SERVO_WRITE_SCHEDULER_H
+#define SERVO_WRITE_SCHEDULER_H
+
+#include <stdint.h>
+#include <joint.h>
+#include <robot_topology.h>
+
+/*
+ * Decides which joints get a servo write in each frame.
+ *
+ * Joints only compute positions. Once per Body::update() the scheduler
+ * compares every joint's position with what its servo last received and
+ * spends a per-frame write budget on the joints that are furthest behind.
+ * Joints that have arrived at their target are always written (exactly,
+ * bypassing hysteresis) so a final position can never be dropped; they
+ * count against the budget first. Joints that miss out this frame keep
+ * their error and rank higher in the next one.
+ */
+class ServoWriteScheduler {
+  public:
+    static const uint8_t MAX_JOINTS = Topology::SERVO_COUNT;
+    static const uint8_t DEFAULT_BUDGET = Topology::SERVO_COUNT / 2;
+
+  private:
+    Joint* _joints[MAX_JOINTS];
+    uint8_t _jointCount;
+    uint8_t _budget;
+
+    // Statistics since last reset
+    uint32_t _frames;
+    uint32_t _finalWrites;
+    uint32_t _budgetWrites;
+    uint32_t _deferred;
+
+  public:
+    ServoWriteScheduler(uint8_t budget = DEFAULT_BUDGET);
+
+    // Register a joint (called once per joint at construction)
+    void add(Joint& joint);
+
+    // Maximum servo writes per frame (final positions are written even
+    // beyond this); 0 is treated as 1
+    void setBudget(uint8_t writes);
+    uint8_t getBudget() const { return _budget; }
+
+    // Stage this frame's servo writes into the ServoFrame
+    // Returns the number of servos written
+    uint8_t schedule();
+
+    // Statistics
+    uint32_t getFrameCount() const { return _frames; }
+    uint32_t getFinalWriteCount() const { return _finalWrites; }
+    uint32_t getBudgetWriteCount() const { return _budgetWrites; }
+    uint32_t getDeferredCount() const { return _deferred; }
+    void resetStats();
+};
+
+#endif
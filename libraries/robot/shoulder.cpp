@@ -1,5 +1,5 @@
 #include <shoulder.h>
 
-Shoulder::Shoulder(Servo &servo, uint16_t initialPos)
-  : Joint(servo, initialPos) {
+Shoulder::Shoulder(Servo &servo, JointStates &states, AngleQ8 initialPos)
+  : Joint(servo, states, initialPos) {
 }
@@ -8,7 +8,7 @@
  */
 class Shoulder : public Joint {
   public:
-    Shoulder(Servo &servo, uint16_t initialPos);
+    Shoulder(Servo &servo, JointStates &states, AngleQ8 initialPos);
 };
 
 #endif
@@ -0,0 +1,5 @@
+#include <tibia.h>
+
+Tibia::Tibia(Servo &servo, JointStates &states, AngleQ8 initialPos)
+  : Joint(servo, states, initialPos) {
+}
@@ -0,0 +1,14 @@
+#ifndef TIBIA_H
+#define TIBIA_H
+
+#include <joint.h>
+
+/*
+ * Tibia joint - lower leg segment on 3-DOF legs (ROBOT_LEG_DOF=3).
+ */
+class Tibia : public Joint {
+  public:
+    Tibia(Servo &servo, JointStates &states, AngleQ8 initialPos);
+};
+
+#endif
@@ -0,0 +1,35 @@
+#include <wire_bus.h>
+
+#include <Wire.h>
+
+bool WireBus::begin(int sda, int scl) {
+  // ESP32: Initialize I2C with custom pins
+  return Wire.begin(sda, scl);
+}
+
+bool WireBus::write(uint8_t address, const uint8_t* data, uint8_t length) {
+  Wire.beginTransmission(address);
+  Wire.write(data, length);
+  return Wire.endTransmission() == 0;
+}
+
+bool WireBus::read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) {
+  Wire.beginTransmission(address);
+  Wire.write(reg);
+  if (Wire.endTransmission(false) != 0) {
+    return false;  // Device did not acknowledge register pointer
+  }
+
+  if (Wire.requestFrom(address, length) != length) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < length; i++) {
+    data[i] = Wire.read();
+  }
+  return true;
+}
+
+bool WireBus::setClock(uint32_t hz) {
+  return Wire.setClock(hz);
+}
@@ -0,0 +1,20 @@
+#ifndef WIRE_BUS_H
+#define WIRE_BUS_H
+
+#include <i_i2c_bus.h>
+
+/*
+ * I2C bus backed by the Arduino Wire peripheral.
+ */
+class WireBus : public II2cBus {
+  public:
+    // Start the I2C peripheral on the given pins
+    bool begin(int sda, int scl);
+
+    // II2cBus interface implementation
+    bool write(uint8_t address, const uint8_t* data, uint8_t length) override;
+    bool read(uint8_t address, uint8_t reg, uint8_t* data, uint8_t length) override;
+    bool setClock(uint32_t hz) override;
+};
+
+#endif
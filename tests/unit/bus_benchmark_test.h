@@ -0,0 +1,109 @@
+#ifndef BUS_BENCHMARK_TEST_H
+#define BUS_BENCHMARK_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <bus_benchmark.h>
+#include <mock_pca9685.h>
+
+// Test suite for I2C clock selection
+namespace BusBenchmarkTest {
+
+  void testSelectsFastestRate() {
+    Log::println("\n=== Selects Fastest Reliable Rate ===");
+
+    MockPca9685Boards boards;  // Power-on state: auto-increment off
+    BusBenchmark bench(boards);
+
+    SHOULD(bench.run(5) == 1000000);
+    SHOULD(boards.bus(0).getClock() == 1000000);
+    SHOULD(bench.getResult(0).reliable());
+    SHOULD(bench.getResult(2).reliable());
+  }
+
+  void testFallsBackWhenReadBackFails() {
+    Log::println("\n=== Falls Back When Read-Back Fails ===");
+
+    MockPca9685Boards boards;
+    boards.bus(0).setMaxReliableClock(400000);  // Long wires: 1 MHz corrupts data
+    BusBenchmark bench(boards);
+
+    SHOULD(bench.run(5) == 400000);
+    SHOULD(boards.bus(0).getClock() == 400000);
+    SHOULD(bench.getResult(2).reliable() == false);
+    SHOULD(bench.getResult(2).errors == 5);
+  }
+
+  void testStopsAtFirstFailingRate() {
+    Log::println("\n=== Stops At First Failing Rate ===");
+
+    MockPca9685Boards boards;
+    boards.bus(0).setGlitchClock(400000);  // 400 kHz fails, 1 MHz would read back fine
+    BusBenchmark bench(boards);
+
+    SHOULD(bench.run(5) == 100000);
+    SHOULD(boards.bus(0).getClock() == 100000);
+    SHOULD(bench.getResult(1).reliable() == false);
+    SHOULD(bench.getResult(2).measured == false);
+    SHOULD(bench.getResult(2).reliable() == false);
+  }
+
+  void testEveryBoardMustBeReliable() {
+    Log::println("\n=== Every Board Must Be Reliable ===");
+
+    // Last board (0x41 with two drivers) is furthest along the bus
+    MockPca9685Boards boards;
+    uint8_t last = Topology::DRIVER_COUNT - 1;
+    boards.bus(last).setMaxReliableClock(400000);
+    BusBenchmark bench(boards);
+
+    SHOULD(bench.run(5) == 400000);
+    for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+      SHOULD(boards.bus(d).getClock() == 400000);
+    }
+    SHOULD(bench.getResult(1).reliable());
+    SHOULD(bench.getResult(2).errors == 5);  // Only the last board failed
+  }
+
+  void testNoDeviceUsesSlowestRate() {
+    Log::println("\n=== No Device Uses Slowest Rate ===");
+
+    MockPca9685 bus(0x60);  // Nothing answers at the topology addresses
+    BusBenchmark bench(bus);
+
+    SHOULD(bench.run(5) == 100000);
+    SHOULD(bench.getResult(0).reliable() == false);
+  }
+
+  void testScratchRegistersRestored() {
+    Log::println("\n=== Scratch Registers Restored ===");
+
+    MockPca9685Boards boards;
+    BusBenchmark bench(boards);
+    bench.run(5);
+
+    for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+      SHOULD(boards.bus(d).getRegister(Pca9685::REG_SUBADR1) == 0xE2);
+    }
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("      BUS BENCHMARK TEST SUITE");
+    Log::println("========================================");
+
+    testSelectsFastestRate();
+    testFallsBackWhenReadBackFails();
+    testStopsAtFirstFailingRate();
+    testEveryBoardMustBeReliable();
+    testNoDeviceUsesSlowestRate();
+    testScratchRegistersRestored();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace BusBenchmarkTest
+
+#endif
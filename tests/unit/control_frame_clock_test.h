@@ -0,0 +1,92 @@
+#ifndef CONTROL_FRAME_CLOCK_TEST_H
+#define CONTROL_FRAME_CLOCK_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <control_frame_clock.h>
+
+// Test suite for fixed-rate control frames
+namespace ControlFrameClockTest {
+
+  void testFramesOnFixedGrid() {
+    Log::println("\n=== Frames On Fixed 20 ms Grid ===");
+
+    ControlFrameClock clock(50);
+    SHOULD(clock.getFrameMs() == 20);
+
+    clock.start(1000);
+    SHOULD(clock.poll(1000) == true);
+    SHOULD(clock.poll(1500) == false);
+    SHOULD(clock.poll(20999) == false);
+
+    // Polled a little late - frame still stamped on the grid
+    SHOULD(clock.poll(23000) == true);
+    SHOULD(clock.getFrameStartUs() == 21000);
+    SHOULD(clock.poll(41000) == true);
+    SHOULD(clock.getFrameCount() == 3);
+    SHOULD(clock.getOverrunCount() == 0);
+  }
+
+  void testOverrunSkipsMissedFrames() {
+    Log::println("\n=== Overrun Skips Missed Frames ===");
+
+    ControlFrameClock clock(50);
+    clock.start(0);
+    clock.poll(0);
+
+    // Next frame due at 20 ms, loop stalled until 75 ms
+    SHOULD(clock.poll(75000) == true);
+    SHOULD(clock.getOverrunCount() == 1);
+    SHOULD(clock.getSkippedFrameCount() == 2);
+    SHOULD(clock.getFrameStartUs() == 60000);
+    SHOULD(clock.getElapsedMs() == 60);  // The step covers the skipped frames
+
+    // One frame, not a burst of catch-up frames
+    SHOULD(clock.poll(76000) == false);
+    SHOULD(clock.poll(80000) == true);
+    SHOULD(clock.getElapsedMs() == 20);
+  }
+
+  void testRateIsWholeRefreshPeriods() {
+    Log::println("\n=== Rate Is Whole Refresh Periods ===");
+
+    ControlFrameClock clock(50);
+    clock.setPeriodsPerFrame(2);
+    SHOULD(clock.getFrameMs() == 40);
+    SHOULD(clock.getRateHz() == 25.0f);
+
+    clock.start(0);
+    clock.poll(0);
+    SHOULD(clock.poll(20000) == false);
+    SHOULD(clock.poll(40000) == true);
+  }
+
+  void testMicrosWrap() {
+    Log::println("\n=== micros() Wraparound ===");
+
+    ControlFrameClock clock(50);
+    clock.start(0xFFFFF000);
+    clock.poll(0xFFFFF000);
+    SHOULD(clock.poll(0x00000100) == false);
+    SHOULD(clock.poll(0xFFFFF000 + 20000) == true);
+    SHOULD(clock.getOverrunCount() == 0);
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       CONTROL FRAME CLOCK TEST SUITE");
+    Log::println("========================================");
+
+    testFramesOnFixedGrid();
+    testOverrunSkipsMissedFrames();
+    testRateIsWholeRefreshPeriods();
+    testMicrosWrap();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace ControlFrameClockTest
+
+#endif
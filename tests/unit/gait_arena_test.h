@@ -0,0 +1,236 @@
+#ifndef GAIT_ARENA_TEST_H
+#define GAIT_ARENA_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <multi_step_gait.h>
+#include <gait_sequences.h>
+#include <gait_format.h>
+#include <gait_arena.h>
+#include <mock_pca9685.h>
+
+// Test suite for binary gait upload
+namespace GaitArenaTest {
+
+  // Tripod A lifts slowly, then lowers quickly
+  const GaitStep LIFT_STEPS[] = {
+    { "Lift A", {0, -23, 400}, {0, 0, 0}, {0, -23, 400}, {0, 0, 0}, {0, 23, 400}, {0, 0, 0}, true },
+    { "Lower A", {0, 23, 0}, {0, 0, 0}, {0, 23, 0}, {0, 0, 0}, {0, -23, 0}, {0, 0, 0}, true, true },
+  };
+  const GaitSequenceData LIFT = { "lift", LIFT_STEPS, 2, true };
+
+  // Lifts and never lowers
+  const GaitSequenceData OPEN = { "open", LIFT_STEPS, 1, true };
+
+  // Swings a shoulder past the safe range
+  const GaitStep SWING_STEPS[] = {
+    { "Swing", {100, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true },
+  };
+  const GaitSequenceData SWING = { "swing", SWING_STEPS, 1, false };
+
+  // Rewrite the checksum after editing a blob
+  void reseal(uint8_t* blob, size_t size) {
+    uint32_t crc = GaitFormat::crc32(blob, size - GaitFormat::CRC_SIZE);
+    for (uint8_t i = 0; i < GaitFormat::CRC_SIZE; i++) {
+      blob[size - GaitFormat::CRC_SIZE + i] = (uint8_t)(crc >> (8 * i));
+    }
+  }
+
+  void testRoundTrip() {
+    Log::println("\n=== Encoded Gaits Decode To The Same Steps ===");
+
+    uint8_t blob[GaitFormat::MAX_BLOB_SIZE];
+    size_t size = GaitFormat::encode(LIFT, blob, sizeof(blob));
+    SHOULD(size == GaitFormat::blobSize(2, false));
+    SHOULD(GaitFormat::validate(blob, size) == GaitFormat::Error::NONE);
+    SHOULD(GaitFormat::crc32((const uint8_t*)"123456789", 9) == 0xCBF43926);
+
+    GaitArena arena;
+    SHOULD(arena.load(blob, size) == GaitFormat::Error::NONE);
+    const GaitSequenceData* loaded = arena.find("lift");
+    SHOULD(loaded != nullptr);
+    SHOULD(loaded->stepCount == 2);
+    SHOULD(loaded->looping);
+    SHOULD(loaded->startPose == nullptr);
+    SHOULD(loaded->steps[0].leftFront.kneeDelta == -23);
+    SHOULD(loaded->steps[0].leftFront.duration == 400);
+    SHOULD(loaded->steps[1].rightMiddle.kneeDelta == -23);
+    SHOULD(loaded->steps[1].synchronizedArrival);
+    SHOULD(!loaded->steps[0].synchronizedArrival);
+    SHOULD(strcmp(loaded->steps[1].name, "lift") == 0);
+
+    // Names with spaces cannot be selected by command
+    GaitSequenceData spaced = LIFT;
+    spaced.name = "two words";
+    SHOULD(GaitFormat::encode(spaced, blob, sizeof(blob)) == 0);
+  }
+
+  void testBadBlobsRejected() {
+    Log::println("\n=== Corrupt Or Unsafe Gaits Are Rejected ===");
+
+    uint8_t blob[GaitFormat::MAX_BLOB_SIZE];
+    size_t size = GaitFormat::encode(LIFT, blob, sizeof(blob));
+
+    blob[30] ^= 0x01;
+    SHOULD(GaitFormat::validate(blob, size) == GaitFormat::Error::BAD_CHECKSUM);
+    blob[30] ^= 0x01;
+
+    SHOULD(GaitFormat::validate(blob, size - 1) == GaitFormat::Error::BAD_SIZE);
+    SHOULD(GaitFormat::validate(blob, 10) == GaitFormat::Error::TOO_SHORT);
+
+    blob[4] = GaitFormat::VERSION + 1;
+    reseal(blob, size);
+    SHOULD(GaitFormat::validate(blob, size) == GaitFormat::Error::BAD_VERSION);
+
+    size = GaitFormat::encode(SWING, blob, sizeof(blob));
+    SHOULD(GaitFormat::validate(blob, size) == GaitFormat::Error::OUT_OF_RANGE);
+
+    // Starting past the safe range, even with steps that stay put
+    const LegMovement FAR_POSE[Topology::LEG_COUNT] = {
+      { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 127, 0 }
+    };
+    const GaitStep STILL_STEPS[] = {
+      { "Still", {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true },
+    };
+    GaitSequenceData farStart = { "far", STILL_STEPS, 1, true, FAR_POSE };
+    size = GaitFormat::encode(farStart, blob, sizeof(blob));
+    SHOULD(GaitFormat::validate(blob, size) == GaitFormat::Error::OUT_OF_RANGE);
+
+    size = GaitFormat::encode(OPEN, blob, sizeof(blob));
+    SHOULD(GaitFormat::validate(blob, size) == GaitFormat::Error::NOT_CLOSED);
+
+    // A rejected gait leaves the arena alone
+    GaitArena arena;
+    SHOULD(arena.load(blob, size) == GaitFormat::Error::NOT_CLOSED);
+    SHOULD(arena.getCount() == 0);
+  }
+
+  void testSlotsAreFixed() {
+    Log::println("\n=== Gaits Fill Fixed Slots, Same Name Replaces ===");
+
+    GaitArena arena;
+    uint8_t blob[GaitFormat::MAX_BLOB_SIZE];
+    char names[GaitArena::SLOTS + 1][8];
+    GaitSequenceData data = LIFT;
+
+    for (uint8_t i = 0; i <= GaitArena::SLOTS; i++) {
+      snprintf(names[i], sizeof(names[i]), "gait%d", i);
+      data.name = names[i];
+      size_t size = GaitFormat::encode(data, blob, sizeof(blob));
+      GaitFormat::Error expected = i < GaitArena::SLOTS ? GaitFormat::Error::NONE
+                                                         : GaitFormat::Error::NO_FREE_SLOT;
+      SHOULD(arena.load(blob, size) == expected);
+    }
+    SHOULD(arena.getCount() == GaitArena::SLOTS);
+
+    // Reloading keeps the slot, and the pointer a running gait holds
+    const GaitSequenceData* before = arena.find("gait1");
+    data.name = "gait1";
+    data.stepCount = 1;
+    data.looping = false;
+    uint8_t slot = 0;
+    SHOULD(arena.load(blob, GaitFormat::encode(data, blob, sizeof(blob)), &slot) == GaitFormat::Error::NONE);
+    SHOULD(slot == 1);
+    SHOULD(arena.find("gait1") == before);
+    SHOULD(before->stepCount == 1);
+
+    SHOULD(arena.remove("gait2"));
+    SHOULD(arena.find("gait2") == nullptr);
+    SHOULD(arena.getCount() == GaitArena::SLOTS - 1);
+  }
+
+  void testHexUpload() {
+    Log::println("\n=== Hex Chunks Upload A Gait ===");
+
+    uint8_t blob[GaitFormat::MAX_BLOB_SIZE];
+    size_t size = GaitFormat::encode(LIFT, blob, sizeof(blob));
+    char hex[2 * GaitFormat::MAX_BLOB_SIZE + 1];
+    for (size_t i = 0; i < size; i++) {
+      snprintf(hex + 2 * i, 3, "%02x", blob[i]);
+    }
+
+    // Sent in 20-byte lines, as over Bluetooth
+    GaitArena arena;
+    SHOULD(arena.beginUpload(size));
+    bool sent = true;
+    for (size_t at = 0; at < 2 * size; at += 40) {
+      char chunk[41] = {};
+      strncpy(chunk, hex + at, 40);
+      sent = sent && arena.appendHex(chunk);
+    }
+    SHOULD(sent);
+    const char* name = nullptr;
+    SHOULD(arena.checkUpload(&name) == GaitFormat::Error::NONE);
+    SHOULD(name != nullptr && strcmp(name, "lift") == 0);
+    SHOULD(arena.find("lift") == nullptr);   // Checked, not loaded yet
+    SHOULD(arena.finishUpload() == GaitFormat::Error::NONE);
+    SHOULD(arena.find("lift") != nullptr);
+
+    // Short, malformed or oversized uploads load nothing
+    SHOULD(arena.beginUpload(size));
+    SHOULD(arena.appendHex("474149"));
+    SHOULD(arena.checkUpload() == GaitFormat::Error::BAD_SIZE);
+    SHOULD(arena.finishUpload() == GaitFormat::Error::BAD_SIZE);
+    SHOULD(arena.beginUpload(size));
+    SHOULD(!arena.appendHex("47x1"));
+    SHOULD(!arena.beginUpload(GaitFormat::MAX_BLOB_SIZE + 1));
+    SHOULD(arena.getCount() == 1);
+  }
+
+  void testUploadedGaitWalks() {
+    Log::println("\n=== An Uploaded Gait Moves Joints Like Its Table ===");
+
+    uint8_t blob[GaitFormat::MAX_BLOB_SIZE];
+    GaitArena arena;
+    arena.load(blob, GaitFormat::encode(LIFT, blob, sizeof(blob)));
+
+    MockPca9685 bus;
+    Board board;
+    Body table(board, bus);
+    Body uploaded(board, bus);
+    MultiStepGait tableGait(&LIFT);
+    MultiStepGait uploadedGait(&STATIONARY_SEQUENCE);
+    uploadedGait.setSequenceData(arena.find("lift"));
+    SHOULD(uploadedGait.getCycles() == 0);   // Looping - walks until stopped
+
+    bool same = true;
+    for (uint8_t step = 0; step < LIFT.stepCount; step++) {
+      table.applyGait(tableGait);
+      uploaded.applyGait(uploadedGait);
+      for (int frame = 0; frame < 100 && !(table.atTarget() && uploaded.atTarget()); frame++) {
+        table.update(20);
+        uploaded.update(20);
+        for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+          same = same && table.leg(leg).knee().getPosition() == uploaded.leg(leg).knee().getPosition();
+        }
+      }
+      tableGait.advance();
+      uploadedGait.advance();
+    }
+    SHOULD(same);
+    SHOULD(uploaded.leftFront().knee().getPosition() == board.servoMiddle());
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       GAIT ARENA TEST SUITE");
+    Log::println("========================================");
+
+    testRoundTrip();
+    testBadBlobsRejected();
+    testSlotsAreFixed();
+    testHexUpload();
+    testUploadedGaitWalks();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace GaitArenaTest
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef GAIT_COMPILER_TEST_H
+#define GAIT_COMPILER_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <multi_step_gait.h>
+#include <gait_sequences.h>
+#include <gait_compiler.h>
+#include <mock_pca9685.h>
+
+// Test suite for compile-time gait tables
+namespace GaitCompilerTest {
+
+  // Checked by the compiler - a table that fails here does not build
+  constexpr uint8_t LF_KNEE = Topology::servoIndex(0, Topology::KNEE);
+  static_assert(FORWARD_WALK_COMPILED.steps[0].target[LF_KNEE] == JointMotion::degrees(67),
+                "Lift body puts the left front knee at 67 degrees");
+  static_assert(STATIONARY_COMPILED.steps[0].activeMask == 0,
+                "Stationary moves nothing");
+
+  void testStepsResolveToAbsoluteTargets() {
+    Log::println("\n=== Steps Resolve To Absolute Targets ===");
+
+    const GaitCompiler::CompiledStep& lift = FORWARD_WALK_COMPILED.steps[0];
+
+    // Tripod A knees move, nothing else
+    uint32_t tripodA = (1UL << Topology::servoIndex(0, Topology::KNEE)) |
+                       (1UL << Topology::servoIndex(2, Topology::KNEE)) |
+                       (1UL << Topology::servoIndex(4, Topology::KNEE));
+    SHOULD(lift.activeMask == tripodA);
+    SHOULD(lift.target[Topology::servoIndex(4, Topology::KNEE)] == JointMotion::degrees(113));
+    SHOULD(lift.target[Topology::servoIndex(1, Topology::SHOULDER)] == JointMotion::degrees(90));
+    SHOULD(lift.speed[LF_KNEE] == JointMotion::degreesPerSecond(180));
+
+    // 23° at 180°/s, rounded up
+    SHOULD(lift.durationMs == 128);
+
+    // Later steps carry the earlier steps' moves
+    const GaitCompiler::CompiledStep& swing = FORWARD_WALK_COMPILED.steps[1];
+    SHOULD(swing.target[LF_KNEE] == JointMotion::degrees(67));
+    SHOULD(swing.target[Topology::servoIndex(1, Topology::SHOULDER)] == JointMotion::degrees(100));
+  }
+
+  void testCompiledMatchesDeltas() {
+    Log::println("\n=== Compiled Steps Move Joints Like The Deltas ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body deltas(board, bus);
+    Body compiled(board, bus);
+    MultiStepGait deltaGait(&FORWARD_WALK_SEQUENCE);
+    MultiStepGait compiledGait(&FORWARD_WALK_SEQUENCE, FORWARD_WALK_COMPILED.steps);
+
+    bool same = true;
+    for (uint8_t step = 0; step < FORWARD_WALK_SEQUENCE.stepCount; step++) {
+      deltas.applyGait(deltaGait);
+      compiled.applyGait(compiledGait);
+      for (int frame = 0; frame < 100 && !(deltas.atTarget() && compiled.atTarget()); frame++) {
+        deltas.update(20);
+        compiled.update(20);
+      }
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+          same = same && deltas.leg(leg).joint(joint).getPosition() ==
+                         compiled.leg(leg).joint(joint).getPosition();
+        }
+      }
+      deltaGait.advance();
+      compiledGait.advance();
+    }
+    SHOULD(same);
+    SHOULD(compiledGait.isComplete());
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       GAIT COMPILER TEST SUITE");
+    Log::println("========================================");
+
+    testStepsResolveToAbsoluteTargets();
+    testCompiledMatchesDeltas();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace GaitCompilerTest
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef GAIT_GENERATOR_TEST_H
+#define GAIT_GENERATOR_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <multi_step_gait.h>
+#include <gait_generator.h>
+#include <gait_transition.h>
+#include <mock_pca9685.h>
+
+// Test suite for parametric gait generation
+namespace GaitGeneratorTest {
+
+  // Joint angles of every leg (whole degrees from middle) at each step
+  // of the cycle, starting from the sequence's startPose
+  void walkPoses(const GaitSequenceData* data, int16_t poses[][Topology::LEG_COUNT][2]) {
+    const GaitStep* steps = data->steps;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      poses[0][leg][0] = data->startPose[leg].shoulderDelta;
+      poses[0][leg][1] = data->startPose[leg].kneeDelta;
+    }
+    for (uint8_t s = 0; s < data->stepCount; s++) {
+      const LegMovement* legs[Topology::LEG_COUNT] = {
+        &steps[s].leftFront, &steps[s].leftMiddle, &steps[s].leftRear,
+        &steps[s].rightFront, &steps[s].rightMiddle, &steps[s].rightRear
+      };
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        poses[s + 1][leg][0] = poses[s][leg][0] + legs[leg]->shoulderDelta;
+        poses[s + 1][leg][1] = poses[s][leg][1] + legs[leg]->kneeDelta;
+      }
+    }
+  }
+
+  // Most legs with the knee lifted at any point of the cycle
+  uint8_t mostLegsLifted(const GaitSequenceData* data) {
+    int16_t poses[GaitGenerator::STEPS_PER_CYCLE + 1][Topology::LEG_COUNT][2];
+    walkPoses(data, poses);
+    uint8_t most = 0;
+    for (uint8_t s = 0; s < data->stepCount; s++) {
+      uint8_t lifted = 0;
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        lifted += poses[s][leg][1] != 0 ? 1 : 0;
+      }
+      if (lifted > most) most = lifted;
+    }
+    return most;
+  }
+
+  void testCyclesClose() {
+    Log::println("\n=== Every Generated Cycle Ends Where It Started ===");
+
+    GaitGenerator generator;
+    const GaitSequenceData* data = generator.getSequenceData();
+    const GaitFamily families[] = { GaitFamily::TRIPOD, GaitFamily::RIPPLE, GaitFamily::WAVE };
+
+    for (GaitFamily family : families) {
+      SHOULD(generator.generate({ family, 27, 19, 0, 1000 }));
+      SHOULD(data->stepCount == GaitGenerator::STEPS_PER_CYCLE);
+      SHOULD(data->looping);
+
+      int16_t poses[GaitGenerator::STEPS_PER_CYCLE + 1][Topology::LEG_COUNT][2];
+      walkPoses(data, poses);
+      bool closed = true;
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        closed = closed && poses[data->stepCount][leg][0] == poses[0][leg][0] &&
+                           poses[data->stepCount][leg][1] == poses[0][leg][1];
+      }
+      SHOULD(closed);
+    }
+
+    // Each step takes its share of the period
+    SHOULD(data->steps[0].leftFront.duration == 83);
+  }
+
+  void testFamiliesLiftTheirGroups() {
+    Log::println("\n=== Tripod Lifts Three Legs, Ripple Two, Wave One ===");
+
+    GaitGenerator generator;
+    const GaitSequenceData* data = generator.getSequenceData();
+
+    SHOULD(generator.generate({ GaitFamily::TRIPOD, 20, 23, 0, 1200 }));
+    SHOULD(mostLegsLifted(data) == 3);
+    SHOULD(generator.getParameters().dutyFactor == 128);
+
+    // Tripod A together, tripod B on the ground
+    int16_t poses[GaitGenerator::STEPS_PER_CYCLE + 1][Topology::LEG_COUNT][2];
+    walkPoses(data, poses);
+    bool together = true;
+    for (uint8_t s = 0; s < data->stepCount; s++) {
+      together = together && poses[s][0][1] == poses[s][2][1] &&
+                             poses[s][0][1] == -poses[s][4][1] &&
+                             (poses[s][0][1] == 0 || poses[s][1][1] == 0);
+    }
+    SHOULD(together);
+
+    SHOULD(generator.generate({ GaitFamily::RIPPLE, 20, 23, 0, 1200 }));
+    SHOULD(mostLegsLifted(data) == 2);
+
+    SHOULD(generator.generate({ GaitFamily::WAVE, 20, 23, 0, 1800 }));
+    SHOULD(mostLegsLifted(data) == 1);
+    SHOULD(generator.getParameters().dutyFactor == 213);
+  }
+
+  void testRegeneratesInPlace() {
+    Log::println("\n=== New Parameters Rewrite The Same Gait ===");
+
+    GaitGenerator generator;
+    MultiStepGait gait(generator.getSequenceData());
+    int8_t stride = generator.getSequenceData()->startPose[0].shoulderDelta;
+
+    // A longer stride reaches further forward from the same buffers
+    SHOULD(generator.generate({ GaitFamily::TRIPOD, 40, 23, 0, 1200 }));
+    SHOULD(gait.getSequenceData() == generator.getSequenceData());
+    SHOULD(generator.getSequenceData()->startPose[0].shoulderDelta == 2 * stride);
+
+    // Out of range leaves the last gait alone
+    SHOULD(!generator.generate({ GaitFamily::WAVE, 40, 23, 100, 1200 }));
+    SHOULD(!generator.generate({ GaitFamily::WAVE, 40, 23, 0, 50 }));
+    SHOULD(generator.getParameters().family == GaitFamily::TRIPOD);
+    SHOULD(generator.getParameters().strideDeg == 40);
+  }
+
+  void testBodyWalksGeneratedGait() {
+    Log::println("\n=== Body Walks Into And Around A Generated Cycle ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    GaitGenerator generator;
+    GaitTransition transition;
+
+    // From rest the legs first move out to their offsets
+    const GaitSequenceData* keyframes = transition.plan(body, generator.getSequenceData());
+    SHOULD(keyframes->stepCount > 0);
+    MultiStepGait keyframeGait(keyframes);
+    for (uint8_t s = 0; s < keyframes->stepCount; s++) {
+      body.applyGait(keyframeGait);
+      for (int frame = 0; frame < 100 && !body.atTarget(); frame++) {
+        body.update(20);
+      }
+      keyframeGait.advance();
+    }
+
+    // Then a full cycle brings every joint back to where it began
+    MultiStepGait gait(generator.getSequenceData());
+    gait.jumpTo(transition.getEntryStep());
+    AngleQ8 before[Topology::SERVO_COUNT];
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        before[Topology::servoIndex(leg, joint)] = body.leg(leg).joint(joint).getPosition();
+      }
+    }
+    for (uint8_t s = 0; s < gait.getStepCount(); s++) {
+      body.applyGait(gait);
+      for (int frame = 0; frame < 100 && !body.atTarget(); frame++) {
+        body.update(20);
+      }
+      gait.advance();
+    }
+    bool back = true;
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      for (uint8_t joint = 0; joint < Topology::JOINTS_PER_LEG; joint++) {
+        back = back && body.leg(leg).joint(joint).getPosition() ==
+                       before[Topology::servoIndex(leg, joint)];
+      }
+    }
+    SHOULD(back);
+    SHOULD(!gait.isComplete());   // Generated gaits keep walking
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       GAIT GENERATOR TEST SUITE");
+    Log::println("========================================");
+
+    testCyclesClose();
+    testFamiliesLiftTheirGroups();
+    testRegeneratesInPlace();
+    testBodyWalksGeneratedGait();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace GaitGeneratorTest
+
+#endif
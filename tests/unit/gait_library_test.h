@@ -0,0 +1,173 @@
+#ifndef GAIT_LIBRARY_TEST_H
+#define GAIT_LIBRARY_TEST_H
+
+#include <stdio.h>
+#include <string.h>
+#include <unit_test.h>
+#include <logging.h>
+#include <multi_step_gait.h>
+#include <gait_format.h>
+#include <gait_library.h>
+#include <gait_generator.h>
+#include <board.h>
+#include <body.h>
+#include <mock_pca9685.h>
+#include "gait_arena_test.h"
+
+// Test suite for the flash-resident gait library
+namespace GaitLibraryTest {
+
+  // A small library: a table gait and a generated one with a start pose
+  size_t buildImage(uint8_t* image, size_t capacity) {
+    static GaitGenerator generator;
+    const GaitSequenceData* gaits[] = { &GaitArenaTest::LIFT, generator.getSequenceData() };
+    return GaitLibrary::write(gaits, 2, image, capacity);
+  }
+
+  void testIndexResolvesNames() {
+    Log::println("\n=== Index Resolves Names To Blobs In Place ===");
+
+    static uint8_t image[2048];
+    size_t size = buildImage(image, sizeof(image));
+    SHOULD(size > 0);
+
+    GaitLibrary library;
+    SHOULD(library.open(image, size));
+    SHOULD(library.getCount() == 2);
+    SHOULD(strcmp(library.getName(1), "Tripod") == 0);
+
+    // Blobs are read where they are, not copied
+    size_t blobSize = 0;
+    const uint8_t* blob = library.findBlob("lift", &blobSize);
+    SHOULD(blob > image && blob < image + size);
+    SHOULD(blobSize == GaitFormat::blobSize(2, false));
+    SHOULD(library.findBlob("missing", nullptr) == nullptr);
+
+    // Selecting makes one gait active, its steps left in the blob
+    const GaitSequenceData* tripod = library.select("Tripod");
+    SHOULD(tripod != nullptr);
+    SHOULD(tripod->stepCount == GaitGenerator::STEPS_PER_CYCLE);
+    SHOULD(tripod->startPose != nullptr);
+    const GaitSequenceData* lift = library.select("lift");
+    SHOULD(lift == tripod);
+    SHOULD(lift->stepCount == 2);
+    SHOULD(lift->steps == nullptr);
+    SHOULD(lift->blob == blob);
+    GaitStep buffer;
+    SHOULD(GaitFormat::stepOf(*lift, 0, buffer).leftFront.kneeDelta == -23);
+  }
+
+  void testSelectedGaitWalksFromFlash() {
+    Log::println("\n=== A Selected Gait Walks Its Steps From The Blob ===");
+
+    static uint8_t image[2048];
+    size_t size = buildImage(image, sizeof(image));
+    GaitLibrary library;
+    library.open(image, size);
+
+    // Same joints, step for step, as the table the blob was written from
+    MockPca9685 bus;
+    Board board;
+    Body table(board, bus);
+    Body flash(board, bus);
+    MultiStepGait tableGait(&GaitArenaTest::LIFT);
+    MultiStepGait flashGait(&STATIONARY_SEQUENCE);
+    flashGait.setSequenceData(library.select("lift"));
+
+    bool same = true;
+    for (uint8_t step = 0; step < 2 * GaitArenaTest::LIFT.stepCount; step++) {
+      same = same && flashGait.getCurrentStep() == tableGait.getCurrentStep();
+      same = same && flashGait.overlapsNextStep() == tableGait.overlapsNextStep();
+      same = same && flashGait.synchronizesArrival() == tableGait.synchronizesArrival();
+      table.applyGait(tableGait);
+      flash.applyGait(flashGait);
+      for (int frame = 0; frame < 100 && !(table.atTarget() && flash.atTarget()); frame++) {
+        table.update(20);
+        flash.update(20);
+        for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+          same = same && table.leg(leg).knee().getPosition() == flash.leg(leg).knee().getPosition();
+        }
+      }
+      tableGait.advance();
+      flashGait.advance();
+    }
+    SHOULD(same);
+    SHOULD(flashGait.getCycle() == 2);   // Looped back through step 0
+    SHOULD(flash.leftFront().knee().getPosition() == board.servoMiddle());
+  }
+
+  void testDamageIsRefused() {
+    Log::println("\n=== Erased Flash And Damaged Gaits Are Refused ===");
+
+    static uint8_t image[2048];
+    size_t size = buildImage(image, sizeof(image));
+    GaitLibrary library;
+
+    // Erased flash reads as 0xFF
+    static uint8_t erased[256];
+    memset(erased, 0xFF, sizeof(erased));
+    SHOULD(!library.open(erased, sizeof(erased)));
+    SHOULD(library.getCount() == 0);
+
+    // Index damage fails the open, blob damage only that gait
+    image[GaitLibrary::HEADER_SIZE] ^= 0x01;
+    SHOULD(!library.open(image, size));
+    image[GaitLibrary::HEADER_SIZE] ^= 0x01;
+    SHOULD(!library.open(image, size - 1));
+
+    size_t blobSize = 0;
+    SHOULD(library.open(image, size));
+    uint8_t* blob = const_cast<uint8_t*>(library.findBlob("lift", &blobSize));
+    blob[blobSize - 1] ^= 0x01;
+    SHOULD(library.select("lift") == nullptr);
+    SHOULD(library.select("Tripod") != nullptr);
+  }
+
+  void testMappedFile() {
+    Log::println("\n=== Host Build Maps The Image From A File ===");
+
+#if defined(ESP32)
+    Log::println("  (host only - the ESP32 maps its gaits partition)");
+#else
+    static uint8_t image[2048];
+    size_t size = buildImage(image, sizeof(image));
+    const char* path = "/tmp/robot_spider_gaits_test.bin";
+    FILE* file = fopen(path, "wb");
+    SHOULD(file != nullptr);
+    if (file == nullptr) {
+      return;
+    }
+    fwrite(image, 1, size, file);
+    fclose(file);
+
+    GaitLibrary library;
+    SHOULD(library.openPartition(path));
+    SHOULD(library.getCount() == 2);
+    const GaitSequenceData* lift = library.select("lift");
+    SHOULD(lift != nullptr && lift->stepCount == 2);
+    library.close();
+    SHOULD(library.getCount() == 0);
+    remove(path);
+
+    SHOULD(!library.openPartition(path));
+#endif
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       GAIT LIBRARY TEST SUITE");
+    Log::println("========================================");
+
+    testIndexResolvesNames();
+    testSelectedGaitWalksFromFlash();
+    testDamageIsRefused();
+    testMappedFile();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace GaitLibraryTest
+
+#endif
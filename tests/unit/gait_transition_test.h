@@ -0,0 +1,180 @@
+#ifndef GAIT_TRANSITION_TEST_H
+#define GAIT_TRANSITION_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <multi_step_gait.h>
+#include <gait_sequences.h>
+#include <gait_transition.h>
+#include <gait_generator.h>
+#include <string.h>
+#include <mock_pca9685.h>
+
+// Test suite for direct gait-to-gait transitions
+namespace GaitTransitionTest {
+
+  // Tripod A lifts, then lowers - entry poses are the middle and tripod A up
+  const GaitStep LIFT_STEPS[] = {
+    { "Lift A", {0, -23, 0}, {0, 0, 0}, {0, -23, 0}, {0, 0, 0}, {0, 23, 0}, {0, 0, 0}, true },
+    { "Lower A", {0, 23, 0}, {0, 0, 0}, {0, 23, 0}, {0, 0, 0}, {0, -23, 0}, {0, 0, 0}, true },
+  };
+
+  const GaitSequenceData LIFT_SEQUENCE = { "Lift", LIFT_STEPS, 2, true };
+
+  // Stands with the left front shoulder far forward (80° from middle)
+  const LegMovement FAR_START_POSE[Topology::LEG_COUNT] = {
+    { 80, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }
+  };
+  const GaitStep HOLD_STEPS[] = {
+    { "Hold", {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true },
+  };
+  const GaitSequenceData FAR_SEQUENCE = { "Far", HOLD_STEPS, 1, true, FAR_START_POSE };
+
+  // Apply each step of gait up to (not including) step, waiting for arrival
+  void walkTo(Body& body, MultiStepGait& gait, uint8_t step) {
+    gait.reset();
+    for (uint8_t i = 0; i < step; i++) {
+      body.applyGait(gait);
+      for (int frame = 0; frame < 100 && !body.atTarget(); frame++) {
+        body.update(20);
+      }
+      gait.advance();
+    }
+  }
+
+  void testAtRestNeedsNoKeyframes() {
+    Log::println("\n=== From Rest, A Gait Starts At Step 0 ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    GaitTransition transition;
+
+    const GaitSequenceData* keyframes = transition.plan(body, &FORWARD_WALK_SEQUENCE);
+    SHOULD(keyframes->stepCount == 0);
+    SHOULD(transition.getEntryStep() == 0);
+  }
+
+  void testMidStrideJoinsMatchingStep() {
+    Log::println("\n=== Mid-Stride, The Same Gait Picks Up Where It Is ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    MultiStepGait forward(&FORWARD_WALK_SEQUENCE);
+    GaitTransition transition;
+
+    // Body lifted and tripod B swung forward - exactly the pose before step 2
+    walkTo(body, forward, 2);
+    const GaitSequenceData* keyframes = transition.plan(body, &FORWARD_WALK_SEQUENCE);
+    SHOULD(keyframes->stepCount == 0);
+    SHOULD(transition.getEntryStep() == 2);
+  }
+
+  void testTransitionMovesOneTripodAtATime() {
+    Log::println("\n=== Transition Reaches The Nearest Step, One Tripod At A Time ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    MultiStepGait forward(&FORWARD_WALK_SEQUENCE);
+    GaitTransition transition;
+
+    // Tripod A is already lifted, so "Lower A" is 10° away and step 0 is 23°
+    walkTo(body, forward, 2);
+    const GaitSequenceData* keyframes = transition.plan(body, &LIFT_SEQUENCE);
+    SHOULD(transition.getEntryStep() == 1);
+
+    // Tripod A has nothing to do, tripod B lifts, swings its shoulders back
+    // and lowers again
+    SHOULD(keyframes->stepCount == 3);
+    SHOULD(strcmp(keyframes->steps[0].name, "Lift B") == 0);
+    SHOULD(keyframes->steps[0].leftMiddle.kneeDelta == -GaitGenerator::DEFAULT_LIFT_DEG);
+    SHOULD(keyframes->steps[0].rightFront.kneeDelta == GaitGenerator::DEFAULT_LIFT_DEG);
+    SHOULD(keyframes->steps[0].rightFront.shoulderDelta == 0);
+    SHOULD(keyframes->steps[1].leftMiddle.shoulderDelta == -10);
+    SHOULD(keyframes->steps[1].rightFront.shoulderDelta == 10);
+    SHOULD(keyframes->steps[1].rightRear.shoulderDelta == 10);
+    SHOULD(keyframes->steps[1].rightRear.kneeDelta == 0);
+    SHOULD(keyframes->steps[2].rightRear.kneeDelta == -GaitGenerator::DEFAULT_LIFT_DEG);
+    SHOULD(keyframes->steps[2].leftFront.kneeDelta == 0);
+
+    // Running the keyframes lands on the entry pose, with tripod B's feet
+    // clear of the ground all the while its shoulders swing
+    AngleQ8 kneeBefore = body.leftMiddle().knee().getPosition();
+    MultiStepGait keyframeGait(keyframes);
+    bool lifted = true;
+    for (uint8_t step = 0; step < keyframes->stepCount; step++) {
+      body.applyGait(keyframeGait);
+      for (int frame = 0; frame < 100 && !body.atTarget(); frame++) {
+        body.update(20);
+        if (step == 1) {
+          lifted = lifted && body.leftMiddle().knee().getPosition() == kneeBefore - JointMotion::degrees(GaitGenerator::DEFAULT_LIFT_DEG);
+        }
+      }
+      keyframeGait.advance();
+    }
+    SHOULD(lifted);
+    SHOULD(body.leftMiddle().knee().getPosition() == kneeBefore);
+    SHOULD(body.leftMiddle().shoulder().getPosition() == board.servoMiddle());
+    SHOULD(body.rightFront().shoulder().getPosition() == board.servoMiddle());
+    SHOULD(body.leftFront().knee().getPosition() == JointMotion::degrees(67));
+    SHOULD(body.rightMiddle().knee().getPosition() == JointMotion::degrees(113));
+  }
+
+  void testLongMoveSplitsKeyframe() {
+    Log::println("\n=== A Move Beyond One Delta Takes Two Keyframes ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    GaitTransition transition;
+
+    // Left front shoulder 80° back, entry pose 80° forward - 160° in all
+    body.leftFront().shoulder().setTarget(board.servoMiddle() - JointMotion::degrees(80),
+                                          JointMotion::degreesPerSecond(1000));
+    for (int frame = 0; frame < 100 && !body.atTarget(); frame++) {
+      body.update(20);
+    }
+
+    const GaitSequenceData* keyframes = transition.plan(body, &FAR_SEQUENCE);
+    SHOULD(keyframes->stepCount == 4);
+    SHOULD(strcmp(keyframes->steps[1].name, "Swing A") == 0);
+    SHOULD(strcmp(keyframes->steps[2].name, "Swing A") == 0);
+    SHOULD(keyframes->steps[1].leftFront.shoulderDelta == INT8_MAX);
+    SHOULD(keyframes->steps[2].leftFront.shoulderDelta == 160 - INT8_MAX);
+    SHOULD(keyframes->steps[2].leftFront.kneeDelta == 0);
+
+    // The gait is entered from its real start pose, not 33° short of it
+    MultiStepGait keyframeGait(keyframes);
+    for (uint8_t step = 0; step < keyframes->stepCount; step++) {
+      body.applyGait(keyframeGait);
+      for (int frame = 0; frame < 200 && !body.atTarget(); frame++) {
+        body.update(20);
+      }
+      keyframeGait.advance();
+    }
+    SHOULD(body.leftFront().shoulder().getPosition() == board.servoMiddle() + JointMotion::degrees(80));
+    SHOULD(body.leftFront().knee().getPosition() == board.servoMiddle());
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       GAIT TRANSITION TEST SUITE");
+    Log::println("========================================");
+
+    testAtRestNeedsNoKeyframes();
+    testMidStrideJoinsMatchingStep();
+    testTransitionMovesOneTripodAtATime();
+    testLongMoveSplitsKeyframe();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace GaitTransitionTest
+
+#endif
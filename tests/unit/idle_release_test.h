@@ -0,0 +1,130 @@
+#ifndef IDLE_RELEASE_TEST_H
+#define IDLE_RELEASE_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <pca9685.h>
+#include <servo.h>
+#include <servo_frame.h>
+#include <left_front_leg.h>
+#include <mock_pca9685.h>
+
+// Test suite for idle de-energize (PCA9685 full-off) and re-engage
+namespace IdleReleaseTest {
+
+  void testServoReleaseSendsFullOff() {
+    Log::println("\n=== Servo Release Sends Full-Off ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+
+    Board board;
+    ServoFrame frame;
+    Servo servo(board, frame, 0);
+    servo.move(JointMotion::degrees(60));
+    frame.flush(boards.drivers());
+
+    servo.release();
+    SHOULD(servo.isReleased());
+    frame.flush(boards.drivers());
+    SHOULD(boards.servoOff(0) == Pca9685::FULL_OFF);
+
+    // Releasing again stages nothing
+    servo.release();
+    SHOULD(frame.flush(boards.drivers()) == false);
+  }
+
+  void testServoEngageRestoresLastAngle() {
+    Log::println("\n=== Servo Engage Restores Last Angle ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+
+    Board board;
+    ServoFrame frame;
+    Servo servo(board, frame, 0);
+    servo.move(JointMotion::degrees(60));
+    servo.release();
+    frame.flush(boards.drivers());
+
+    servo.engage();
+    SHOULD(!servo.isReleased());
+    frame.flush(boards.drivers());
+    SHOULD(boards.servoOff(0) == servo.angleToPWM(JointMotion::degrees(60)));
+
+    // Re-engaged servo suppresses an unchanged move as before
+    servo.move(JointMotion::degrees(60));
+    SHOULD(frame.flush(boards.drivers()) == false);
+  }
+
+  void testLegReleasesAfterTimeout() {
+    Log::println("\n=== Leg Releases After Idle Timeout ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    LeftFrontLeg leg(board, frame, states, board.servoMiddle());
+
+    SHOULD(leg.updateIdle(400, 1000) == false);
+    SHOULD(leg.updateIdle(400, 1000) == false);
+    SHOULD(leg.updateIdle(400, 1000) == true);
+    SHOULD(leg.isReleased());
+    SHOULD(frame.get(0) == Pca9685::FULL_OFF);
+    SHOULD(frame.get(1) == Pca9685::FULL_OFF);
+
+    // Timeout of 0 disables release
+    LeftFrontLeg held(board, frame, states, board.servoMiddle());
+    SHOULD(held.updateIdle(60000, 0) == false);
+    SHOULD(!held.isReleased());
+  }
+
+  void testMovingLegNotReleased() {
+    Log::println("\n=== Moving Leg Not Released ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    LeftFrontLeg leg(board, frame, states, board.servoMiddle());
+
+    leg.knee().setTargetDegrees(120.0f, 90.0f);
+    SHOULD(leg.updateIdle(5000, 1000) == false);
+    SHOULD(!leg.isReleased());
+  }
+
+  void testLegEngageRestartsTimer() {
+    Log::println("\n=== Leg Engage Restarts Idle Timer ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    LeftFrontLeg leg(board, frame, states, board.servoMiddle());
+
+    leg.updateIdle(1000, 1000);
+    SHOULD(leg.isReleased());
+
+    leg.engage();
+    SHOULD(!leg.isReleased());
+    SHOULD(frame.get(0) == leg.servo(Topology::SHOULDER).angleToPWM(JointMotion::degrees(90)));
+    SHOULD(leg.updateIdle(500, 1000) == false);
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       IDLE RELEASE TEST SUITE");
+    Log::println("========================================");
+
+    testServoReleaseSendsFullOff();
+    testServoEngageRestoresLastAngle();
+    testLegReleasesAfterTimeout();
+    testMovingLegNotReleased();
+    testLegEngageRestartsTimer();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace IdleReleaseTest
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef JOINT_MOTION_TEST_H
+#define JOINT_MOTION_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <servo.h>
+#include <servo_frame.h>
+#include <joint.h>
+#include <joint_motion.h>
+#include <mock_body.h>
+
+// Test suite for fixed-point joint motion
+namespace JointMotionTest {
+
+  void testConstantMoveLandsExactlyOnTarget() {
+    Log::println("\n=== Constant Move Lands Exactly On Target ===");
+
+    // 10° at 180°/s - 3.6° per 20 ms, arriving at 56 ms
+    MotionPlan plan = MotionProfile::plan(ProfileType::CONSTANT, JointMotion::degrees(90),
+                                          JointMotion::degrees(100),
+                                          JointMotion::degreesPerSecond(180), { 0, 0 });
+    SHOULD(plan.durationMs == 56);
+    SHOULD(MotionProfile::evaluate(plan, 28) == JointMotion::degrees(95));
+    SHOULD(MotionProfile::evaluate(plan, 55) < JointMotion::degrees(100));
+    SHOULD(MotionProfile::evaluate(plan, 56) == JointMotion::degrees(100));
+    SHOULD(MotionProfile::evaluate(plan, 60000) == JointMotion::degrees(100));
+  }
+
+  void testOffsetClampsToSafeRange() {
+    Log::println("\n=== Offset Clamps To Safe Range ===");
+
+    Board board;
+    AngleQ8 min = board.servoSafeMin();
+    AngleQ8 max = board.servoSafeMax();
+
+    SHOULD(JointMotion::offset(JointMotion::degrees(90), 23, min, max) == JointMotion::degrees(113));
+    SHOULD(JointMotion::offset(JointMotion::degrees(90), -23, min, max) == JointMotion::degrees(67));
+    SHOULD(JointMotion::offset(JointMotion::degrees(5), -10, min, max) == min);
+    SHOULD(JointMotion::offset(JointMotion::degrees(170), 20, min, max) == max);
+  }
+
+  void testBoardSpeedIsInteger() {
+    Log::println("\n=== Board Speed Is Integer ===");
+
+    Board board;
+    SHOULD(board.servoSpeed(0, JointMotion::degrees(23)) == JointMotion::degreesPerSecond(180));
+
+    // 20° in 200 ms = 100°/s = 0.1°/ms
+    SHOULD(board.servoSpeed(200, JointMotion::degrees(20)) == (JointMotion::degrees(20) << 8) / 200);
+
+    // Clamped to 600°/s
+    SHOULD(board.servoSpeed(10, JointMotion::degrees(90)) == JointMotion::degreesPerSecond(600));
+  }
+
+  void testJointMatchesMockJoint() {
+    Log::println("\n=== Joint Matches MockJoint Bit For Bit ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    Servo servo(board, frame, 0);
+    Joint joint(servo, states, board.servoMiddle());
+    MockJoint mock("test", board.servoMiddle());
+
+    // Odd speeds and uneven ticks so every rounding path is exercised
+    const AngleQ8 targets[] = { JointMotion::fromDegrees(131.7f), JointMotion::degrees(12),
+                                JointMotion::fromDegrees(90.3f) };
+    const SpeedQ16 speeds[] = { JointMotion::fromDegreesPerSecond(77.0f),
+                                board.servoSpeed(340, JointMotion::degrees(41)),
+                                JointMotion::degreesPerSecond(600) };
+    const uint32_t ticks[] = { 20, 17, 23, 40, 1 };
+
+    int mismatches = 0;
+    for (int t = 0; t < 3; t++) {
+      joint.setTarget(targets[t], speeds[t]);
+      mock.setTarget(targets[t], speeds[t]);
+      for (int i = 0; i < 100; i++) {
+        states.update(ticks[i % 5]);
+        mock.update(ticks[i % 5]);
+        if (joint.getPosition() != mock.getPosition()) mismatches++;
+      }
+    }
+    SHOULD(mismatches == 0);
+    SHOULD(joint.getPosition() == JointMotion::fromDegrees(90.3f));
+  }
+
+  void testJumpMatchesTicks() {
+    Log::println("\n=== Positions Depend Only On Time, Not Tick Jitter ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates ticked, jumped;
+    Servo s0(board, frame, 0), s1(board, frame, 1);
+    Joint t0(s0, ticked, board.servoMiddle()), t1(s1, ticked, board.servoMiddle());
+    Joint j0(s0, jumped, board.servoMiddle()), j1(s1, jumped, board.servoMiddle());
+
+    t0.setTarget(JointMotion::degrees(150), JointMotion::degreesPerSecond(90));
+    t1.setTarget(JointMotion::degrees(40), JointMotion::fromDegreesPerSecond(33.3f));
+    j0.setTarget(JointMotion::degrees(150), JointMotion::degreesPerSecond(90));
+    j1.setTarget(JointMotion::degrees(40), JointMotion::fromDegreesPerSecond(33.3f));
+
+    // Uneven ticks on one, a single jump to the same time on the other
+    const uint32_t ticks[] = { 20, 17, 23, 40, 1 };
+    int mismatches = 0;
+    for (int i = 0; i < 200; i++) {
+      ticked.update(ticks[i % 5]);
+      if (i % 25 == 24) {
+        jumped.advanceTo(ticked.getTime());
+        if (t0.getPosition() != j0.getPosition() || t1.getPosition() != j1.getPosition()) mismatches++;
+      }
+    }
+    SHOULD(mismatches == 0);
+
+    // Arrival time is known up front - 50° at 33.3°/s lands at 1502 ms
+    JointStates timed;
+    Joint k1(s1, timed, board.servoMiddle());
+    k1.setTarget(JointMotion::degrees(40), JointMotion::fromDegreesPerSecond(33.3f));
+    SHOULD(timed.getArrivalTime(1) == 1502);
+    timed.advanceTo(1501);
+    SHOULD(!k1.atTarget());
+    SHOULD(timed.advanceTo(1502));
+    SHOULD(k1.getPosition() == JointMotion::degrees(40));
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       JOINT MOTION TEST SUITE");
+    Log::println("========================================");
+
+    testConstantMoveLandsExactlyOnTarget();
+    testOffsetClampsToSafeRange();
+    testBoardSpeedIsInteger();
+    testJointMatchesMockJoint();
+    testJumpMatchesTicks();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace JointMotionTest
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef LEG_KINEMATICS_TEST_H
+#define LEG_KINEMATICS_TEST_H
+
+#include <math.h>
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <leg_kinematics.h>
+#include <mock_pca9685.h>
+#include <mock_body.h>
+
+// Test suite for foot-space inverse and forward kinematics
+namespace LegKinematicsTest {
+
+  void testTablesMatchLibm() {
+    Log::println("\n=== Table Trig Stays Within 0.05° Of libm ===");
+
+    float worstAtan = 0.0f;
+    for (int32_t y = -400; y <= 400; y += 7) {
+      for (int32_t x = -400; x <= 400; x += 11) {
+        float expected = atan2f((float)y, (float)x) * 180.0f / (float)M_PI;
+        float error = fabsf(LegKinematics::atan2Q8(y, x) / 256.0f - expected);
+        if (error > 180.0f) error = 360.0f - error;   // Either side of ±180°
+        if (error > worstAtan) worstAtan = error;
+      }
+    }
+    Log::println("Worst atan2 error: %.4f°", worstAtan);
+    SHOULD(worstAtan < 0.05f);
+
+    float worstSin = 0.0f;
+    for (int32_t angle = -360 * 256; angle <= 360 * 256; angle += 37) {
+      float expected = sinf(angle / 256.0f * (float)M_PI / 180.0f);
+      float error = fabsf(LegKinematics::sinQ15(angle) / 32768.0f - expected);
+      if (error > worstSin) worstSin = error;
+    }
+    Log::println("Worst sin error: %.5f", worstSin);
+    SHOULD(worstSin < 0.0005f);
+
+    SHOULD(LegKinematics::isqrt(4900) == 70);
+    SHOULD(LegKinematics::isqrt(4899) == 69);
+  }
+
+  void testSolveRoundTrips() {
+    Log::println("\n=== Solved Angles Put The Foot Back Where Asked ===");
+
+    LegKinematics kinematics;
+
+    // Middle angles: leg straight out, dropped by the rest angle
+    FootPosition rest = kinematics.forward({ 0, 0 });
+    SHOULD(rest.x == 0);
+    SHOULD(rest.y == 91);    // 30 + 70 cos 30°
+    SHOULD(rest.z == -35);   // -70 sin 30°
+
+    bool within = true;
+    for (int16_t z = -60; z <= 0; z += 10) {
+      for (int16_t x = -40; x <= 40; x += 10) {
+        LegAngles angles;
+        int16_t y = 0;
+        within = within && kinematics.solve({ x, 0, z }, angles, &y);
+        FootPosition foot = kinematics.forward(angles);
+        within = within && abs(foot.x - x) <= 1 && abs(foot.z - z) <= 1 && abs(foot.y - y) <= 1;
+      }
+    }
+    SHOULD(within);
+
+    // Rest pose solves back to the middle angles
+    LegAngles angles;
+    SHOULD(kinematics.solve({ 0, 0, -35 }, angles));
+    SHOULD(abs(angles.shoulder) < 16);
+    SHOULD(abs(angles.knee) < 64);
+
+    // Deeper than the femur, or further forward than the reach
+    SHOULD(!kinematics.solve({ 0, 0, -71 }, angles));
+    SHOULD(!kinematics.solve({ 101, 0, 0 }, angles));
+  }
+
+  void testBodyMovesFeet() {
+    Log::println("\n=== Body Places Left And Right Feet ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+
+    // Same foot position forward on both sides - mirrored servo angles
+    SHOULD(body.setFootTarget(0, { 20, 0, -35 }, 200));
+    SHOULD(body.setFootTarget(3, { 20, 0, -35 }, 200));
+    SHOULD(body.leftFront().shoulder().getTarget() > board.servoMiddle());
+    SHOULD(body.rightFront().shoulder().getTarget() < board.servoMiddle());
+    SHOULD(body.leftFront().shoulder().getTarget() - board.servoMiddle() ==
+           board.servoMiddle() - body.rightFront().shoulder().getTarget());
+
+    for (int frame = 0; frame < 20 && !body.atTarget(); frame++) {
+      body.update(20);
+    }
+    FootPosition left = body.getFootPosition(0);
+    FootPosition right = body.getFootPosition(3);
+    SHOULD(abs(left.x - 20) <= 1 && abs(left.z + 35) <= 1);
+    SHOULD(left.x == right.x && left.y == right.y && left.z == right.z);
+
+    // Out of reach leaves the leg alone
+    AngleQ8 knee = body.leftFront().knee().getTarget();
+    SHOULD(!body.setFootTarget(0, { 0, 0, -90 }, 200));
+    SHOULD(body.leftFront().knee().getTarget() == knee);
+
+#if ROBOT_LEG_DOF == 3
+    // The tibia is held at middle, where the rigid-femur model holds
+    body.leftFront().tibia().setTarget(JointMotion::degrees(120), JointMotion::degreesPerSecond(1000));
+    SHOULD(body.setFootTarget(0, { 20, 0, -35 }, 200));
+    SHOULD(body.leftFront().tibia().getTarget() == board.servoMiddle());
+#endif
+  }
+
+  void testMockBodyMovesFeetLikeBody() {
+    Log::println("\n=== MockBody Places Feet Like Body ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    MockBody mock;
+    IGaitTarget* targets[2] = { &body, &mock };
+
+    // Through the interface, the same feet land in the same place
+    for (IGaitTarget* target : targets) {
+      SHOULD(target->setFootTarget(1, { 15, 0, -40 }, 300));
+      SHOULD(target->setFootTarget(4, { -10, 0, -30 }, 300));
+      SHOULD(!target->setFootTarget(2, { 0, 0, -90 }, 300));
+      for (int frame = 0; frame < 20 && !target->atTarget(); frame++) {
+        target->update(20);
+      }
+      SHOULD(target->atTarget());
+    }
+
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      FootPosition a = body.getFootPosition(leg);
+      FootPosition b = mock.getFootPosition(leg);
+      SHOULD(a.x == b.x && a.y == b.y && a.z == b.z);
+    }
+    FootPosition moved = mock.getFootPosition(1);
+    SHOULD(abs(moved.x - 15) <= 1 && abs(moved.z + 40) <= 1);
+  }
+
+  void testSixLegsFitInAFrame() {
+    Log::println("\n=== Solving All Six Legs Per Frame ===");
+
+    LegKinematics kinematics;
+    const uint32_t FRAMES = 2000;
+    volatile int32_t sink = 0;
+
+    uint32_t start = micros();
+    for (uint32_t frame = 0; frame < FRAMES; frame++) {
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        LegAngles angles;
+        int16_t x = (int16_t)((frame + leg * 7) % 60) - 30;
+        int16_t z = -20 - (int16_t)((frame + leg * 3) % 30);
+        kinematics.solve({ x, 0, z }, angles);
+        sink = sink + angles.shoulder + angles.knee;
+      }
+    }
+    uint32_t elapsed = micros() - start;
+
+    float perFrameUs = elapsed / (float)FRAMES;
+    Log::println("Six-leg solve: %.2fus per frame (%lu frames)", perFrameUs, (unsigned long)FRAMES);
+
+    // A 50Hz frame is 20ms - the solver should be a small slice of it
+    SHOULD(perFrameUs < 1000.0f);
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       LEG KINEMATICS TEST SUITE");
+    Log::println("========================================");
+
+    testTablesMatchLibm();
+    testSolveRoundTrips();
+    testBodyMovesFeet();
+    testMockBodyMovesFeetLikeBody();
+    testSixLegsFitInAFrame();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace LegKinematicsTest
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef MOTION_COMPLETE_TEST_H
+#define MOTION_COMPLETE_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <joint_states.h>
+#include <mock_body.h>
+#include <mock_pca9685.h>
+
+// Test suite for the moving-joint count and motion complete callback
+namespace MotionCompleteTest {
+
+  void testMovingCountTracksTargets() {
+    Log::println("\n=== Moving Count Tracks Targets ===");
+
+    JointStates states;
+    SHOULD(states.allAtTarget());
+
+    states.setTarget(0, JointMotion::degrees(120), JointMotion::degreesPerSecond(600));
+    states.setTarget(1, JointMotion::degrees(60), JointMotion::degreesPerSecond(600));
+    SHOULD(states.getMovingCount() == 2);
+
+    // Retargeting a moving joint does not count it twice; sending it
+    // back to where it is takes it out of the count
+    states.setTarget(0, JointMotion::degrees(150), JointMotion::degreesPerSecond(600));
+    states.setTarget(1, JointMotion::degrees(90), JointMotion::degreesPerSecond(600));
+    SHOULD(states.getMovingCount() == 1);
+
+    SHOULD(states.update(50) == false);  // 30 of 60 degrees
+    SHOULD(states.update(50) == true);   // Last joint arrives
+    SHOULD(states.allAtTarget());
+    SHOULD(states.update(50) == false);  // Arrival is reported once
+  }
+
+  void testBodyCallbackFiresOncePerStep() {
+    Log::println("\n=== Body Callback Fires Once Per Step ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+
+    int completions = 0;
+    body.onMotionComplete([&completions]() { completions++; });
+
+    body.leftFront().shoulder().setTarget(JointMotion::degrees(100), JointMotion::degreesPerSecond(100));
+    body.resetToMiddle();  // Cancels that move before any update, but is still a step
+    SHOULD(body.atTarget());
+
+    // A step that moves nothing completes on the next update
+    body.update(20);
+    SHOULD(completions == 1);
+    body.update(20);
+    SHOULD(completions == 1);
+
+    body.resetToMiddle();
+    body.rightRear().knee().setTarget(JointMotion::degrees(110), JointMotion::degreesPerSecond(100));
+    SHOULD(!body.atTarget());
+
+    int updates = 0;
+    while (!body.atTarget() && updates < 100) {
+      body.update(20);
+      updates++;
+    }
+    SHOULD(updates == 10);  // 20 degrees at 100 degrees/second
+    SHOULD(completions == 2);
+    body.update(20);
+    SHOULD(completions == 2);
+
+    body.onMotionComplete(nullptr);
+  }
+
+  void testMockBodyMatchesBody() {
+    Log::println("\n=== MockBody Reports Completion Like Body ===");
+
+    MockBody body;
+    int completions = 0;
+    body.onMotionComplete([&completions]() { completions++; });
+
+    body.applyLeftFront(10, -10);
+    body.applyRightRear(0, 0);
+    SHOULD(!body.atTarget());
+
+    int updates = 0;
+    while (!body.atTarget() && updates < 100) {
+      body.update(20);
+      updates++;
+    }
+    SHOULD(completions == 1);
+    body.update(20);
+    SHOULD(completions == 1);
+
+    // All-zero step still completes
+    body.applyLeftFront(0, 0);
+    body.update(20);
+    SHOULD(completions == 2);
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       MOTION COMPLETE TEST SUITE");
+    Log::println("========================================");
+
+    testMovingCountTracksTargets();
+    testBodyCallbackFiresOncePerStep();
+    testMockBodyMatchesBody();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace MotionCompleteTest
+
+#endif
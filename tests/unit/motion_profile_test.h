@@ -0,0 +1,136 @@
+#ifndef MOTION_PROFILE_TEST_H
+#define MOTION_PROFILE_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <motion_profile.h>
+#include <joint_states.h>
+
+// Test suite for trapezoid and S-curve joint velocity profiles
+namespace MotionProfileTest {
+
+  // Largest movement in any 1 ms of the plan, in Q8.8 degrees
+  uint32_t peakStep(const MotionPlan& plan) {
+    uint32_t peak = 0;
+    AngleQ8 last = plan.start;
+    for (uint32_t t = 1; t <= plan.durationMs; t++) {
+      AngleQ8 pos = MotionProfile::evaluate(plan, t);
+      uint32_t step = JointMotion::distance(pos, last);
+      if (step > peak) peak = step;
+      last = pos;
+    }
+    return peak;
+  }
+
+  void testTrapezoidCruisesAtPeakSpeed() {
+    Log::println("\n=== Trapezoid Cruises At Peak Speed ===");
+
+    // 120° at 200°/s with 2000°/s² - 100 ms ramps, 600 ms at speed
+    MotionLimits limits = { 2000, 0 };
+    MotionPlan plan = MotionProfile::plan(ProfileType::TRAPEZOID, JointMotion::degrees(30),
+                                          JointMotion::degrees(150),
+                                          JointMotion::degreesPerSecond(200), limits);
+    SHOULD(plan.rampMs == 100);
+    SHOULD(plan.durationMs == 700);
+
+    // Starts slowly, 0.2°/ms at cruise, and lands exactly on the target
+    SHOULD(MotionProfile::evaluate(plan, 10) - JointMotion::degrees(30) < JointMotion::ONE_DEGREE / 8);
+    uint32_t peak = peakStep(plan);
+    SHOULD(peak >= 51 && peak <= 52);
+    SHOULD(MotionProfile::evaluate(plan, 350) == JointMotion::degrees(90));
+    SHOULD(MotionProfile::evaluate(plan, 700) == JointMotion::degrees(150));
+  }
+
+  void testShortTrapezoidIsTriangle() {
+    Log::println("\n=== Short Trapezoid Is A Triangle ===");
+
+    // 12° cannot reach 600°/s at 3000°/s² - accelerate half way, brake half way
+    MotionLimits limits = { 3000, 0 };
+    MotionPlan plan = MotionProfile::plan(ProfileType::TRAPEZOID, JointMotion::degrees(90),
+                                          JointMotion::degrees(78),
+                                          JointMotion::degreesPerSecond(600), limits);
+    SHOULD(plan.rampMs == 63);
+    SHOULD(plan.durationMs == 126);
+    SHOULD(JointMotion::distance(MotionProfile::evaluate(plan, 63), JointMotion::degrees(84)) <= 1);
+    SHOULD(peakStep(plan) < JointMotion::degreesPerSecond(600) >> 8);
+    SHOULD(MotionProfile::evaluate(plan, 126) == JointMotion::degrees(78));
+  }
+
+  void testTimedTrapezoidStretchesToDuration() {
+    Log::println("\n=== Timed Trapezoid Stretches To The Duration ===");
+
+    // The 700 ms move above given 1000 ms - a shorter ramp to a slower cruise
+    MotionLimits limits = { 2000, 0 };
+    MotionPlan plan = MotionProfile::planTimed(ProfileType::TRAPEZOID, JointMotion::degrees(30),
+                                               JointMotion::degrees(150), 1000, limits);
+    SHOULD(plan.durationMs == 1000);
+    SHOULD(plan.rampMs == 64);
+    SHOULD(peakStep(plan) < 51);
+    SHOULD(MotionProfile::evaluate(plan, 500) == JointMotion::degrees(90));
+    SHOULD(MotionProfile::evaluate(plan, 1000) == JointMotion::degrees(150));
+  }
+
+  void testSCurveRespectsLimits() {
+    Log::println("\n=== S-Curve Respects Speed, Accel And Jerk Limits ===");
+
+    MotionLimits limits = { 3000, 100000 };
+    MotionPlan plan = MotionProfile::plan(ProfileType::SCURVE, JointMotion::degrees(60),
+                                          JointMotion::degrees(100),
+                                          JointMotion::degreesPerSecond(600), limits);
+
+    // 40° is jerk limited: (60 * 40 / 100000)^(1/3) s = 289 ms
+    SHOULD(plan.durationMs == 289);
+
+    // Peak speed 1.875 * 40° / 0.289 s = 260°/s, at the midpoint
+    SHOULD(MotionProfile::evaluate(plan, 145) - JointMotion::degrees(80) < JointMotion::ONE_DEGREE / 4);
+    SHOULD(peakStep(plan) <= JointMotion::degreesPerSecond(600) >> 8);
+
+    // Acceleration starts at zero - the first 10 ms cover under 0.02°
+    SHOULD(MotionProfile::evaluate(plan, 10) - JointMotion::degrees(60) < 5);
+    SHOULD(MotionProfile::evaluate(plan, 289) == JointMotion::degrees(100));
+  }
+
+  void testProfiledJointArrives() {
+    Log::println("\n=== Profiled Joint Arrives And Is Counted ===");
+
+    JointStates states;
+    states.setProfile(0, ProfileType::TRAPEZOID, { 2000, 0 });
+    states.setTarget(0, JointMotion::degrees(150), JointMotion::degreesPerSecond(200));
+    SHOULD(states.getMovingCount() == 1);
+
+    // 60° from 90° in 400 ms - arrives exactly when the plan is over
+    int arrivals = 0;
+    int arrivedAt = 0;
+    for (int frame = 1; frame <= 25; frame++) {
+      if (states.update(20)) {
+        arrivals++;
+        arrivedAt = frame;
+      }
+    }
+    SHOULD(arrivals == 1);
+    SHOULD(arrivedAt == 20);
+    SHOULD(states.getPosition(0) == JointMotion::degrees(150));
+
+    // Other joints kept the constant profile
+    SHOULD(states.getProfile(1) == ProfileType::CONSTANT);
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       MOTION PROFILE TEST SUITE");
+    Log::println("========================================");
+
+    testTrapezoidCruisesAtPeakSpeed();
+    testShortTrapezoidIsTriangle();
+    testTimedTrapezoidStretchesToDuration();
+    testSCurveRespectsLimits();
+    testProfiledJointArrives();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace MotionProfileTest
+
+#endif
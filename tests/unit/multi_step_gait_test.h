@@ -0,0 +1,368 @@
+#ifndef MULTI_STEP_GAIT_TEST_H
+#define MULTI_STEP_GAIT_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <multi_step_gait.h>
+#include <joint_states.h>
+#include <gait_sequences.h>
+#include <mock_pca9685.h>
+
+// Test suite for multi-step gait sequencing
+namespace MultiStepGaitTest {
+
+  // Tripod A lifts without waiting, tripod B lifts alongside it, then both lower
+  const GaitStep OVERLAP_STEPS[] = {
+    { "Lift A", {0, -20, 0}, {0, 0, 0}, {0, -20, 0}, {0, 0, 0}, {0, 20, 0}, {0, 0, 0}, false },
+    { "Lift B", {0, 0, 0}, {0, -20, 0}, {0, 0, 0}, {0, 20, 0}, {0, 0, 0}, {0, 20, 0}, true },
+    { "Lower", {0, 20, 0}, {0, 20, 0}, {0, 20, 0}, {0, -20, 0}, {0, -20, 0}, {0, -20, 0}, false },
+  };
+
+  const GaitSequenceData OVERLAP_SEQUENCE = { "Overlap", OVERLAP_STEPS, 3, false };
+  const GaitSequenceData OVERLAP_LOOP = { "Overlap loop", OVERLAP_STEPS, 3, true };
+
+  // One leg moving 10° and 23° at the default speed, with and without synchronized arrival
+  const GaitStep UNEVEN_STEPS[] = {
+    { "Uneven", {10, -23, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true },
+  };
+  const GaitStep SYNCHRONIZED_STEPS[] = {
+    { "Synchronized", {10, -23, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true, true },
+  };
+
+  const GaitSequenceData UNEVEN_SEQUENCE = { "Uneven", UNEVEN_STEPS, 1, false };
+  const GaitSequenceData SYNCHRONIZED_SEQUENCE = { "Synchronized", SYNCHRONIZED_STEPS, 1, false };
+
+  // A short unsynchronized move overlapped by a long synchronized one on another leg
+  const GaitStep OVERLAP_SYNC_STEPS[] = {
+    { "Swing", {10, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, false },
+    { "Lift", {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -23, 0}, {0, 0, 0}, {0, 0, 0}, true, true },
+  };
+  const GaitSequenceData OVERLAP_SYNC_SEQUENCE = { "Overlap sync", OVERLAP_SYNC_STEPS, 2, false };
+
+  // Two 20° knee moves in the same direction, each waiting for the last
+  const GaitStep TWO_MOVE_STEPS[] = {
+    { "First", {0, 20, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true },
+    { "Second", {0, 20, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, true },
+  };
+
+  const GaitSequenceData TWO_MOVE_SEQUENCE = { "Two moves", TWO_MOVE_STEPS, 2, false };
+
+  // Run the gait to completion the way Robot::handleMotionComplete() does
+  // Returns the frames taken, and how far the knee moved in the frame after
+  // the second step was applied
+  int runToCompletion(Body& body, const GaitSequenceData* data, uint32_t& transitionMove) {
+    MultiStepGait gait(data);
+    bool done = false;
+    bool stepped = false;
+    body.onMotionComplete([&]() {
+      gait.advance();
+      if (gait.isComplete()) {
+        done = true;
+      } else {
+        body.applyGait(gait);
+        stepped = true;
+      }
+    });
+    body.applyGait(gait);
+
+    int frames = 0;
+    transitionMove = 0;
+    while (!done && frames < 100) {
+      bool transition = stepped && transitionMove == 0;
+      AngleQ8 before = body.leftFront().knee().getPosition();
+      body.update(20);
+      frames++;
+      if (transition) {
+        transitionMove = JointMotion::distance(before, body.leftFront().knee().getPosition());
+      }
+    }
+    body.onMotionComplete(nullptr);
+    return frames;
+  }
+
+  // Apply the gait's first step and return the frames each joint took to arrive
+  void framesToArrive(Body& body, const GaitSequenceData* data, int& shoulderFrames, int& kneeFrames) {
+    MultiStepGait gait(data);
+    body.applyGait(gait);
+
+    shoulderFrames = 0;
+    kneeFrames = 0;
+    for (int frame = 1; frame <= 100 && !body.atTarget(); frame++) {
+      body.update(20);
+      if (shoulderFrames == 0 && body.leftFront().shoulder().atTarget()) shoulderFrames = frame;
+      if (kneeFrames == 0 && body.leftFront().knee().atTarget()) kneeFrames = frame;
+    }
+  }
+
+  void testOverlapsNextStep() {
+    Log::println("\n=== Non-Blocking Steps Overlap The Next Step ===");
+
+    MultiStepGait gait(&OVERLAP_SEQUENCE);
+    SHOULD(gait.overlapsNextStep());    // Lift A does not wait
+    gait.advance();
+    SHOULD(!gait.overlapsNextStep());   // Lift B waits
+    gait.advance();
+    SHOULD(!gait.overlapsNextStep());   // Last step always waits when not looping
+
+    MultiStepGait loop(&OVERLAP_LOOP);
+    loop.advance();
+    loop.advance();
+    SHOULD(loop.overlapsNextStep());    // ...but runs into step 0 when looping
+  }
+
+  void testCyclesRunBackToBack() {
+    Log::println("\n=== Cycles Run Back To Back ===");
+
+    // The data's looping flag sets the default
+    MultiStepGait once(&OVERLAP_SEQUENCE);
+    SHOULD(once.getCycles() == 1);
+    MultiStepGait loop(&OVERLAP_LOOP);
+    SHOULD(loop.getCycles() == 0);
+
+    // Two cycles: the first cycle's last step runs on into step 0
+    MultiStepGait gait(&OVERLAP_SEQUENCE);
+    gait.setCycles(2);
+    gait.markStepInProgress();
+    gait.advance();
+    gait.advance();
+    SHOULD(gait.hasNextStep());
+    gait.advance();
+    SHOULD(gait.getCurrentStep() == 0);
+    SHOULD(gait.getCycle() == 1);
+    SHOULD(!gait.isComplete());
+
+    // ...and the second cycle's does not
+    gait.advance();
+    gait.advance();
+    SHOULD(!gait.hasNextStep());
+    gait.advance();
+    SHOULD(gait.isComplete());
+
+    // Until stopped: never completes
+    gait.reset();
+    gait.setCycles(0);
+    SHOULD(gait.getCycle() == 0);
+    for (int i = 0; i < 30; i++) {
+      gait.markStepInProgress();
+      gait.advance();
+      SHOULD(!gait.isComplete());
+    }
+    SHOULD(gait.getCycle() == 10);
+  }
+
+  // True if every joint's deltas over one cycle add up to nothing
+  bool cycleCloses(const GaitSequenceData& data) {
+    int shoulder[6] = { 0 };
+    int knee[6] = { 0 };
+    for (uint8_t i = 0; i < data.stepCount; i++) {
+      const GaitStep& step = data.steps[i];
+      const LegMovement* legs[6] = { &step.leftFront, &step.leftMiddle, &step.leftRear,
+                                     &step.rightFront, &step.rightMiddle, &step.rightRear };
+      for (int leg = 0; leg < 6; leg++) {
+        shoulder[leg] += legs[leg]->shoulderDelta;
+        knee[leg] += legs[leg]->kneeDelta;
+      }
+    }
+    for (int leg = 0; leg < 6; leg++) {
+      if (shoulder[leg] != 0 || knee[leg] != 0) return false;
+    }
+    return true;
+  }
+
+  void testWalkingCyclesClose() {
+    Log::println("\n=== Walking Cycles End Where They Start ===");
+
+    // Continuous walking repeats these - any leftover would drift each cycle
+    SHOULD(cycleCloses(FORWARD_WALK_SEQUENCE));
+    SHOULD(cycleCloses(BACKWARD_SEQUENCE));
+    SHOULD(cycleCloses(LEFT_SEQUENCE));
+    SHOULD(cycleCloses(RIGHT_SEQUENCE));
+  }
+
+  void testOverlappedStepsMoveTogether() {
+    Log::println("\n=== Overlapped Steps Move Together ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    MultiStepGait gait(&OVERLAP_SEQUENCE);
+
+    // What Robot::applyGaitSteps() does on a new command
+    body.applyGait(gait);
+    while (gait.overlapsNextStep()) {
+      gait.advance();
+      body.applyGait(gait);
+    }
+    SHOULD(gait.getCurrentStep() == 1);
+
+    // Both tripods are under way after one frame, and arrive together
+    body.update(20);
+    SHOULD(body.leftFront().knee().getPosition() < board.servoMiddle());
+    SHOULD(body.rightFront().knee().getPosition() > board.servoMiddle());
+
+    int updates = 1;
+    while (!body.atTarget() && updates < 100) {
+      body.update(20);
+      updates++;
+    }
+    SHOULD(body.leftFront().knee().getPosition() == JointMotion::degrees(70));
+    SHOULD(body.leftMiddle().knee().getPosition() == JointMotion::degrees(70));
+    SHOULD(updates == 6);  // 20° at 180°/s, not twice that
+  }
+
+  void testSynchronizedArrival() {
+    Log::println("\n=== Synchronized Step Joints Arrive Together ===");
+
+    MockPca9685 bus;
+    Board board;
+    int shoulderFrames, kneeFrames;
+
+    // Each at 180°/s: 10° lands in 3 frames, 23° in 7
+    Body uneven(board, bus);
+    framesToArrive(uneven, &UNEVEN_SEQUENCE, shoulderFrames, kneeFrames);
+    SHOULD(shoulderFrames == 3);
+    SHOULD(kneeFrames == 7);
+
+    // Synchronized, the 10° shoulder slows to land with the knee
+    Body synchronized(board, bus);
+    framesToArrive(synchronized, &SYNCHRONIZED_SEQUENCE, shoulderFrames, kneeFrames);
+    SHOULD(shoulderFrames == 7);
+    SHOULD(kneeFrames == 7);
+    SHOULD(synchronized.leftFront().shoulder().getPosition() == JointMotion::degrees(100));
+    SHOULD(synchronized.leftFront().knee().getPosition() == JointMotion::degrees(67));
+
+    // The body-wide setting synchronizes steps that do not ask for it
+    Body everyStep(board, bus);
+    everyStep.setSynchronizedArrival(true);
+    framesToArrive(everyStep, &UNEVEN_SEQUENCE, shoulderFrames, kneeFrames);
+    SHOULD(shoulderFrames == 7);
+    SHOULD(kneeFrames == 7);
+
+    // A synchronized step only stretches its own joints, not those of an
+    // overlapped step applied in the same frame
+    Body overlapped(board, bus);
+    MultiStepGait gait(&OVERLAP_SYNC_SEQUENCE);
+    overlapped.applyGait(gait);
+    gait.advance();
+    overlapped.applyGait(gait);
+    for (int frame = 0; frame < 3; frame++) {
+      overlapped.update(20);
+    }
+    SHOULD(overlapped.leftFront().shoulder().atTarget());
+    SHOULD(!overlapped.rightFront().knee().atTarget());
+  }
+
+  void testBlendedStepsKeepMoving() {
+    Log::println("\n=== Blended Steps Keep Moving Through The Transition ===");
+
+    MockPca9685 bus;
+    Board board;
+    uint32_t transitionMove;
+
+    // Trapezoid moves brake to a stop between steps
+    Body stopping(board, bus);
+    stopping.setMotionProfile(ProfileType::TRAPEZOID, board.servoLimits());
+    int stoppingFrames = runToCompletion(stopping, &TWO_MOVE_SEQUENCE, transitionMove);
+    SHOULD(stoppingFrames == 18);
+    SHOULD(transitionMove < JointMotion::ONE_DEGREE);   // Starting again from rest
+    SHOULD(stopping.leftFront().knee().getPosition() == JointMotion::degrees(130));
+
+    // Within 5° the second step starts on top of the first's braking
+    Body blended(board, bus);
+    blended.setMotionProfile(ProfileType::TRAPEZOID, board.servoLimits());
+    blended.setBlendRadius(JointMotion::degrees(5));
+    int blendedFrames = runToCompletion(blended, &TWO_MOVE_SEQUENCE, transitionMove);
+    SHOULD(blendedFrames < stoppingFrames);
+    SHOULD(transitionMove > 3 * JointMotion::ONE_DEGREE); // Still at speed
+    SHOULD(blended.leftFront().knee().getPosition() == JointMotion::degrees(130));
+  }
+
+  void testReversalIsNotBlended() {
+    Log::println("\n=== Reversal Is Not Blended ===");
+
+    // 30° to 150° slowly, reversed at 31° by a fast move back to 30°
+    JointStates states;
+    states.setBlending(true);
+    states.reset(0, JointMotion::degrees(30));
+    states.setTarget(0, JointMotion::degrees(150), JointMotion::degreesPerSecond(60));
+    states.update(16);
+    AngleQ8 reversedAt = states.getPosition(0);
+    states.setTarget(0, JointMotion::degrees(30), JointMotion::degreesPerSecond(600));
+
+    // Blended, the old move's remainder would drag the sum below 0° and
+    // hold arrival back until it ends (~1984 ms on). Planned from the
+    // current position instead, the fast move back is over at once
+    AngleQ8 lowest = reversedAt;
+    AngleQ8 highest = reversedAt;
+    int arrivals = 0;
+    bool earlyArrival = false;
+    for (int frame = 1; frame <= 110; frame++) {
+      if (states.update(20)) {
+        arrivals++;
+        earlyArrival = earlyArrival || frame <= 2;
+      }
+      AngleQ8 pos = states.getPosition(0);
+      if (pos < lowest) lowest = pos;
+      if (pos > highest) highest = pos;
+    }
+    SHOULD(lowest >= JointMotion::degrees(30));
+    SHOULD(highest <= reversedAt);
+    SHOULD(arrivals == 1);
+    SHOULD(earlyArrival);
+    SHOULD(states.getPosition(0) == JointMotion::degrees(30));
+    SHOULD(states.allAtTarget());
+  }
+
+  void testStackedTargetsStayContinuous() {
+    Log::println("\n=== Stacked Targets Stay Continuous ===");
+
+    // Three onward targets, each set while the joint is still moving
+    JointStates states;
+    states.setBlending(true);
+    states.reset(0, JointMotion::degrees(30));
+    SpeedQ16 speed = JointMotion::degreesPerSecond(60);   // 1.2° per frame
+
+    AngleQ8 last = states.getPosition(0);
+    AngleQ8 largestStep = 0;
+    const uint8_t TARGETS[3] = { 60, 90, 120 };
+    for (int frame = 0; frame < 150; frame++) {
+      if (frame % 10 == 0 && frame < 30) {
+        states.setTarget(0, JointMotion::degrees(TARGETS[frame / 10]), speed);
+      }
+      states.update(20);
+      AngleQ8 pos = states.getPosition(0);
+      AngleQ8 step = JointMotion::distance(pos, last);
+      if (step > largestStep) largestStep = step;
+      last = pos;
+    }
+
+    // Two moves at once at most, never a jump from a dropped remainder
+    SHOULD(largestStep <= JointMotion::fromDegrees(2.5f));
+    SHOULD(states.getPosition(0) == JointMotion::degrees(120));
+    SHOULD(states.allAtTarget());
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       MULTI-STEP GAIT TEST SUITE");
+    Log::println("========================================");
+
+    testOverlapsNextStep();
+    testCyclesRunBackToBack();
+    testWalkingCyclesClose();
+    testOverlappedStepsMoveTogether();
+    testSynchronizedArrival();
+    testBlendedStepsKeepMoving();
+    testReversalIsNotBlended();
+    testStackedTargetsStayContinuous();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace MultiStepGaitTest
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef PHASE_GAIT_TEST_H
+#define PHASE_GAIT_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <body.h>
+#include <phase_gait.h>
+#include <phase_gaits.h>
+#include <mock_pca9685.h>
+
+// Test suite for per-leg phase gaits
+namespace PhaseGaitTest {
+
+  // One control frame, as Robot::loop() runs it while walking
+  void frame(Body& body, PhaseGait& gait) {
+    body.update(20);
+    gait.update(body, 20);
+  }
+
+  // Degrees a leg's knee is lifted off the ground (either side mirrors)
+  float kneeLift(Body& body, uint8_t leg) {
+    float knee = JointMotion::toDegrees(body.leg(leg).knee().getPosition());
+    return knee > 90.0f ? knee - 90.0f : 90.0f - knee;
+  }
+
+  void testDutyFactorSetsCycle() {
+    Log::println("\n=== Duty Factor Sets The Cycle Time ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+
+    // Stance / duty: half the cycle on the ground, or five sixths of it
+    PhaseGait tripod(&TRIPOD_PHASE_GAIT);
+    SHOULD(tripod.getCycleMs() == 1200);
+    PhaseGait wave(&WAVE_PHASE_GAIT);
+    SHOULD(wave.getCycleMs() == 1802);
+
+    // A shorter stance walks faster with the same phasing
+    tripod.start(body, 300);
+    SHOULD(tripod.getCycleMs() == 600);
+    SHOULD(tripod.getLegTime(0) == 0);     // Tripod A
+    SHOULD(tripod.getLegTime(1) == 300);   // Tripod B, half a cycle on
+  }
+
+  void testLegsKeepTheirPhase() {
+    Log::println("\n=== Tripod Legs Keep Their Own Phase ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    PhaseGait gait(&TRIPOD_PHASE_GAIT);
+
+    gait.start(body);
+    for (int i = 0; i < 25; i++) {
+      frame(body, gait);                   // Lead-in: 500ms
+    }
+
+    // Tripod A starts its stance forward, tripod B its swing from the back;
+    // right legs mirror the left
+    SHOULD(body.leftFront().shoulder().getPosition() == JointMotion::degrees(100));
+    SHOULD(body.leftMiddle().shoulder().getPosition() == JointMotion::degrees(80));
+    SHOULD(body.rightFront().shoulder().getPosition() == JointMotion::degrees(100));
+    SHOULD(body.rightMiddle().shoulder().getPosition() == JointMotion::degrees(80));
+
+    // Half way: the tripods have swapped, and B's feet are back down
+    for (int i = 0; i < 30; i++) {
+      frame(body, gait);
+    }
+    SHOULD(body.leftFront().shoulder().getPosition() == JointMotion::degrees(80));
+    SHOULD(body.leftMiddle().shoulder().getPosition() == JointMotion::degrees(100));
+    SHOULD(body.leftMiddle().knee().getPosition() == JointMotion::degrees(90));
+
+    // Two whole cycles on (with keyframes between frames), nothing has drifted
+    for (int i = 0; i < 120; i++) {
+      frame(body, gait);
+    }
+    SHOULD(body.leftFront().shoulder().getPosition() == JointMotion::degrees(80));
+    SHOULD(body.leftMiddle().shoulder().getPosition() == JointMotion::degrees(100));
+    SHOULD(body.rightMiddle().shoulder().getPosition() == JointMotion::degrees(100));
+  }
+
+  void testWaveLiftsOneLegAtATime() {
+    Log::println("\n=== Wave Lifts One Leg At A Time ===");
+
+    MockPca9685 bus;
+    Board board;
+    Body body(board, bus);
+    PhaseGait gait(&WAVE_PHASE_GAIT);
+
+    gait.start(body);
+    for (int i = 0; i < 25; i++) {
+      frame(body, gait);
+    }
+
+    // Over a whole cycle every leg swings, never two at once
+    bool lifted[Topology::LEG_COUNT] = { false };
+    int mostLifted = 0;
+    for (int i = 0; i < 91; i++) {
+      frame(body, gait);
+      int count = 0;
+      for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+        if (kneeLift(body, leg) > 3.0f) {
+          lifted[leg] = true;
+          count++;
+        }
+      }
+      if (count > mostLifted) mostLifted = count;
+    }
+    SHOULD(mostLifted == 1);
+    for (uint8_t leg = 0; leg < Topology::LEG_COUNT; leg++) {
+      SHOULD(lifted[leg]);
+    }
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       PHASE GAIT TEST SUITE");
+    Log::println("========================================");
+
+    testDutyFactorSetsCycle();
+    testLegsKeepTheirPhase();
+    testWaveLiftsOneLegAtATime();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace PhaseGaitTest
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef SERVO_CALIBRATION_TEST_H
+#define SERVO_CALIBRATION_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <servo.h>
+#include <servo_calibration.h>
+
+// Test suite for calibrated angle -> PWM tables
+namespace ServoCalibrationTest {
+
+  void testDefaultTableMatchesLinearMapping() {
+    Log::println("\n=== Default Table Matches Linear Mapping ===");
+
+    Board board;
+    ServoAngleTable table;
+    table.build(board.defaultCalibration(), board.pwmSafeMin(), board.pwmSafeMax());
+
+    SHOULD(table.toPWM(JointMotion::degrees(90)) == 347);
+    SHOULD(table.toPWM(JointMotion::degrees(45)) == 150 + 99);   // 197 * 45 / 90, rounded
+    SHOULD(table.toPWM(JointMotion::degrees(0)) == SERVOMIN + 5);    // Safety clamp
+    SHOULD(table.toPWM(JointMotion::degrees(180)) == SERVOMAX - 5);  // Safety clamp
+    SHOULD(table.toPWM(JointMotion::fromDegrees(-20.0f)) == SERVOMIN + 5);  // Out of range clamps
+  }
+
+  void testNonlinearCalibration() {
+    Log::println("\n=== Nonlinear Min/Mid/Max Calibration ===");
+
+    // Servo whose middle sits off-centre: short lower half, long upper half
+    ServoCalibration cal = { 200, 300, 500 };
+    ServoAngleTable table;
+    table.build(cal, 0, 4095);
+
+    SHOULD(table.toPWM(JointMotion::degrees(0)) == 200);
+    SHOULD(table.toPWM(JointMotion::degrees(45)) == 250);
+    SHOULD(table.toPWM(JointMotion::degrees(90)) == 300);
+    SHOULD(table.toPWM(JointMotion::degrees(135)) == 400);
+    SHOULD(table.toPWM(JointMotion::degrees(180)) == 500);
+  }
+
+  void testFractionalInterpolation() {
+    Log::println("\n=== Fractional Degree Interpolation ===");
+
+    ServoCalibration cal = { 0, 900, 1800 };  // 10 ticks per degree
+    ServoAngleTable table;
+    table.build(cal, 0, 4095);
+
+    SHOULD(table.toPWM(JointMotion::degrees(10)) == 100);
+    SHOULD(table.toPWM(JointMotion::fromDegrees(10.5f)) == 105);
+    SHOULD(table.toPWM(JointMotion::fromDegrees(10.25f)) == 102);
+  }
+
+  void testInvalidCalibrationRejected() {
+    Log::println("\n=== Invalid Calibration Rejected ===");
+
+    Board board;
+    ServoCalibrationStore store;
+    store.setSafeRange(board.pwmSafeMin(), board.pwmSafeMax());
+    ServoCalibration good = { 160, 347, 530 };
+    ServoCalibration reversed = { 530, 347, 160 };
+    ServoCalibration tooWide = { 150, 347, 5000 };
+    ServoCalibration unsafe = { 150, 347, 545 };   // Beyond pwmSafeMin/Max
+
+    SHOULD(store.set(0, good) == true);
+    SHOULD(store.set(0, reversed) == false);
+    SHOULD(store.set(0, tooWide) == false);
+    SHOULD(store.set(0, unsafe) == false);
+    SHOULD(store.set(Topology::SERVO_COUNT, good) == false);
+    SHOULD(store.get(0).midPulse == 347);
+  }
+
+  void testRecalibrateResendsPosition() {
+    Log::println("\n=== Recalibrate Re-sends Position ===");
+
+    Board board;
+    ServoFrame frame;
+    Servo servo(board, frame, 2);
+    servo.begin();
+    uint16_t before = frame.get(2);
+
+    ServoCalibration shifted = { 170, 367, 565 };
+    servo.calibrate(shifted);
+
+    SHOULD(frame.get(2) == before + 20);
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("    SERVO CALIBRATION TEST SUITE");
+    Log::println("========================================");
+
+    testDefaultTableMatchesLinearMapping();
+    testNonlinearCalibration();
+    testFractionalInterpolation();
+    testInvalidCalibrationRejected();
+    testRecalibrateResendsPosition();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace ServoCalibrationTest
+
+#endif
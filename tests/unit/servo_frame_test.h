@@ -0,0 +1,229 @@
+#ifndef SERVO_FRAME_TEST_H
+#define SERVO_FRAME_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <pca9685.h>
+#include <servo.h>
+#include <servo_frame.h>
+#include <mock_pca9685.h>
+
+// Test suite for frame-based servo output
+namespace ServoFrameTest {
+
+  void testBeginEnablesAutoIncrement() {
+    Log::println("\n=== PCA9685 Begin Enables Auto-Increment ===");
+
+    MockPca9685 bus;
+    Pca9685 driver(bus);
+
+    SHOULD(driver.begin() == true);
+    SHOULD((bus.getRegister(Pca9685::REG_MODE1) & Pca9685::MODE1_AI) != 0);
+    SHOULD(bus.getRegister(Pca9685::REG_PRESCALE) == 131);  // 27MHz / (4096 * 50Hz) - 1
+  }
+
+  void testPerServoWrites() {
+    Log::println("\n=== Per-Servo Writes (Baseline) ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+    boards.resetCounts();
+
+    // Old path: one transaction per servo
+    const uint8_t count = ServoFrame::SERVO_COUNT;
+    for (uint8_t servo = 0; servo < count; servo++) {
+      Topology::ServoChannel at = Topology::channelOf(servo);
+      boards.drivers()[at.driver].writeChannel(at.channel, 300 + servo);
+    }
+
+    SHOULD(boards.getTransactionCount() == count);
+    SHOULD(boards.getByteCount() == count * (1 + 1 + 4));
+    SHOULD(boards.servoOff(0) == 300);
+    SHOULD(boards.servoOff(count - 1) == 300 + count - 1);
+  }
+
+  void testFrameBurstWrite() {
+    Log::println("\n=== Frame Burst Write ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+    boards.resetCounts();
+
+    ServoFrame frame;
+    for (uint8_t servo = 0; servo < ServoFrame::SERVO_COUNT; servo++) {
+      frame.set(servo, 300 + servo);
+    }
+
+    SHOULD(frame.flush(boards.drivers()) == true);
+
+    // New path: one transaction per board, carrying all of its servos
+    const uint8_t perDriver = Topology::LEGS_PER_DRIVER * Topology::JOINTS_PER_LEG;
+    for (uint8_t d = 0; d < Topology::DRIVER_COUNT; d++) {
+      SHOULD(boards.bus(d).getTransactionCount() == 1);
+      SHOULD(boards.bus(d).getByteCount() == 1 + 1 + perDriver * 4u);
+      SHOULD(boards.bus(d).channelOff(0) == 300 + d * perDriver);
+      SHOULD(boards.bus(d).channelOff(perDriver - 1) == 300 + (d + 1) * perDriver - 1);
+      if (perDriver < Topology::CHANNELS_PER_DRIVER) {
+        SHOULD(boards.bus(d).channelOff(perDriver) == 0);  // Unused channels untouched
+      }
+    }
+    bool all = true;
+    for (uint8_t servo = 0; servo < ServoFrame::SERVO_COUNT; servo++) {
+      all = all && boards.servoOff(servo) == 300 + servo;
+    }
+    SHOULD(all);
+  }
+
+  void testCleanFrameNotSent() {
+    Log::println("\n=== Clean Frame Not Sent ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+
+    ServoFrame frame;
+    frame.set(3, 400);
+    frame.flush(boards.drivers());
+    boards.resetCounts();
+
+    SHOULD(frame.isDirty() == false);
+    SHOULD(frame.flush(boards.drivers()) == false);
+    SHOULD(boards.getTransactionCount() == 0);
+  }
+
+  void testServosShareOneBurst() {
+    Log::println("\n=== Servos Share One Burst ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+    boards.resetCounts();
+
+    Board board;
+    ServoFrame frame;
+    Servo shoulder(board, frame, 0);
+    Servo knee(board, frame, 1);
+
+    shoulder.move(JointMotion::degrees(0));
+    knee.move(JointMotion::degrees(180));
+    SHOULD(boards.getTransactionCount() == 0);  // Staged, not sent
+
+    frame.flush(boards.drivers());
+    SHOULD(boards.getTransactionCount() == 1);
+    SHOULD(boards.servoOff(0) == shoulder.angleToPWM(JointMotion::degrees(0)));
+    SHOULD(boards.servoOff(1) == knee.angleToPWM(JointMotion::degrees(180)));
+  }
+
+  void testUnchangedPwmSuppressed() {
+    Log::println("\n=== Unchanged PWM Suppressed ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+
+    Board board;
+    ServoFrame frame;
+    Servo servo(board, frame, 4);
+    servo.begin();
+    frame.flush(boards.drivers());
+    boards.resetCounts();
+
+    // 90.0 and 90.2 degrees quantize to the same PWM count
+    servo.move(JointMotion::fromDegrees(90.2f));
+    SHOULD(frame.flush(boards.drivers()) == false);
+    SHOULD(boards.getTransactionCount() == 0);
+    SHOULD(frame.getWriteProfiler().getIssuedWrites() == 1);      // begin() only
+    SHOULD(frame.getWriteProfiler().getSuppressedWrites() == 1);
+
+    servo.move(JointMotion::degrees(100));
+    SHOULD(frame.flush(boards.drivers()) == true);
+    SHOULD(frame.getWriteProfiler().getIssuedWrites() == 2);
+  }
+
+  void testHysteresisBand() {
+    Log::println("\n=== Hysteresis Band ===");
+
+    Board board;
+    ServoFrame frame;
+    Servo servo(board, frame, 0);
+    servo.setHysteresis(3);
+    servo.move(JointMotion::degrees(90));
+    uint16_t held = frame.get(0);
+
+    servo.move(JointMotion::degrees(91));  // ~2 ticks - inside band
+    SHOULD(frame.get(0) == held);
+
+    servo.move(JointMotion::degrees(91), true);  // Final position - always written
+    SHOULD(frame.get(0) == servo.angleToPWM(JointMotion::degrees(91)));
+
+    servo.move(JointMotion::degrees(95));  // ~9 ticks - outside band
+    SHOULD(frame.get(0) == servo.angleToPWM(JointMotion::degrees(95)));
+  }
+
+  void testOnlyChangedSpanSent() {
+    Log::println("\n=== Only Changed Span Sent ===");
+
+    MockPca9685Boards boards;
+    boards.begin();
+    boards.resetCounts();
+
+    // Servos 2..4 share the first board in every layout
+    ServoFrame frame;
+    frame.set(2, 300);
+    frame.set(4, 320);
+    frame.flush(boards.drivers());
+
+    // Channels 2..4 in one burst
+    SHOULD(boards.getTransactionCount() == 1);
+    SHOULD(boards.getByteCount() == 1 + 1 + 3 * 4);
+    SHOULD(boards.servoOff(2) == 300);
+    SHOULD(boards.servoOff(4) == 320);
+  }
+
+  void testTopologyChannelMap() {
+    Log::println("\n=== Topology Channel Map ===");
+
+    // Servo index = leg * joints + joint, legs LF..RR
+    SHOULD(Topology::SERVO_COUNT == Topology::LEG_COUNT * Topology::JOINTS_PER_LEG);
+    SHOULD(Topology::legOf(Topology::servoIndex(4, Topology::KNEE)) == 4);
+    SHOULD(Topology::jointOf(Topology::servoIndex(4, Topology::KNEE)) == Topology::KNEE);
+
+    // Every servo lands on its own channel
+    int collisions = 0;
+    for (uint8_t a = 0; a < Topology::SERVO_COUNT; a++) {
+      for (uint8_t b = a + 1; b < Topology::SERVO_COUNT; b++) {
+        Topology::ServoChannel ca = Topology::channelOf(a);
+        Topology::ServoChannel cb = Topology::channelOf(b);
+        if (ca.driver == cb.driver && ca.channel == cb.channel) collisions++;
+      }
+    }
+    SHOULD(collisions == 0);
+
+#if ROBOT_PWM_DRIVERS == 1
+    // Single board: servo n on channel n (the original wiring)
+    SHOULD(Topology::channelOf(11).driver == 0);
+    SHOULD(Topology::channelOf(11).channel == 11);
+#endif
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       SERVO FRAME TEST SUITE");
+    Log::println("========================================");
+
+    testBeginEnablesAutoIncrement();
+    testPerServoWrites();
+    testFrameBurstWrite();
+    testCleanFrameNotSent();
+    testServosShareOneBurst();
+    testUnchangedPwmSuppressed();
+    testHysteresisBand();
+    testOnlyChangedSpanSent();
+    testTopologyChannelMap();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace ServoFrameTest
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef SERVO_OUTPUT_TASK_TEST_H
+#define SERVO_OUTPUT_TASK_TEST_H
+
+#include <Arduino.h>
+#include <unit_test.h>
+#include <logging.h>
+#include <servo_frame.h>
+#include <servo_output_task.h>
+#include <mock_pca9685.h>
+
+// Simulated chip behind a slow bus - every transaction takes writeDelayMs
+class SlowMockPca9685 : public MockPca9685 {
+  private:
+    uint32_t _writeDelayMs;
+
+  public:
+    SlowMockPca9685(uint32_t writeDelayMs) : _writeDelayMs(writeDelayMs) {}
+
+    bool write(uint8_t address, const uint8_t* data, uint8_t length) override {
+      delay(_writeDelayMs);
+      return MockPca9685::write(address, data, length);
+    }
+};
+
+// Test suite for the background servo output task
+namespace ServoOutputTaskTest {
+
+  // Poll until the task has sent everything (or give up after timeoutMs)
+  bool waitIdle(ServoOutputTask& output, uint32_t timeoutMs = 1000) {
+    uint32_t start = millis();
+    while (!output.isIdle()) {
+      if (millis() - start > timeoutMs) return false;
+      delay(1);
+    }
+    return true;
+  }
+
+  void testPublishedFrameIsSent() {
+    Log::println("\n=== Published Frame Is Sent ===");
+
+    MockPca9685 bus;
+    ServoOutputTask output(bus);
+    output.begin();
+    bus.resetCounts();
+
+    // First and last servo on the board at the mock's address
+    const uint8_t last = Topology::LEGS_PER_DRIVER * Topology::JOINTS_PER_LEG - 1;
+    ServoFrame staged;
+    staged.set(0, 300);
+    staged.set(last, 300 + last);
+    output.publish(staged);
+
+    SHOULD(staged.isDirty() == false);  // Handed over
+    SHOULD(waitIdle(output));
+    SHOULD(output.getSentCount() == 1);
+    SHOULD(bus.getTransactionCount() == 1);
+    SHOULD(bus.channelOff(0) == 300);
+    SHOULD(bus.channelOff(last) == 300 + last);
+
+    output.end();
+  }
+
+  void testCleanFrameNotPublished() {
+    Log::println("\n=== Clean Frame Not Published ===");
+
+    MockPca9685 bus;
+    ServoOutputTask output(bus);
+    output.begin();
+
+    ServoFrame staged;
+    output.publish(staged);
+
+    SHOULD(output.getPublishedCount() == 0);
+    output.end();
+  }
+
+  void testPublishDoesNotWaitForBus() {
+    Log::println("\n=== Publish Does Not Wait For Bus ===");
+
+    SlowMockPca9685 slowBus(50);
+    ServoOutputTask slowOutput(slowBus);
+    slowOutput.begin();
+
+    ServoFrame staged;
+    staged.set(3, 400);
+
+    uint32_t start = millis();
+    slowOutput.publish(staged);
+    uint32_t elapsed = millis() - start;
+
+    SHOULD(elapsed < 10);  // Bus write takes 50ms, publish returns at once
+    SHOULD(waitIdle(slowOutput));
+    SHOULD(slowBus.channelOff(3) == 400);
+
+    slowOutput.end();
+  }
+
+  void testLatestFrameWins() {
+    Log::println("\n=== Latest Frame Wins While Bus Busy ===");
+
+    SlowMockPca9685 bus(20);
+    ServoOutputTask output(bus);
+    output.begin();
+
+    // Publish faster than the bus can send
+    ServoFrame staged;
+    for (uint16_t i = 0; i < 5; i++) {
+      staged.set(0, 300 + i);
+      staged.set(i + 1, 400 + i);  // A different channel each frame
+      output.publish(staged);
+    }
+
+    SHOULD(waitIdle(output));
+    SHOULD(output.getPublishedCount() == 5);
+    SHOULD(output.getSentCount() < 5);  // Some frames were merged
+    SHOULD(output.getSentCount() + output.getMergedCount() == 5);
+
+    // Latest value for channel 0, and no channel change was lost
+    SHOULD(bus.channelOff(0) == 304);
+    SHOULD(bus.channelOff(1) == 400);
+    SHOULD(bus.channelOff(5) == 404);
+
+    output.end();
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("    SERVO OUTPUT TASK TEST SUITE");
+    Log::println("========================================");
+
+    testPublishedFrameIsSent();
+    testCleanFrameNotPublished();
+    testPublishDoesNotWaitForBus();
+    testLatestFrameWins();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace ServoOutputTaskTest
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef SERVO_WRITE_SCHEDULER_TEST_H
+#define SERVO_WRITE_SCHEDULER_TEST_H
+
+#include <unit_test.h>
+#include <logging.h>
+#include <board.h>
+#include <servo.h>
+#include <servo_frame.h>
+#include <joint.h>
+#include <servo_write_scheduler.h>
+
+// Test suite for the per-frame servo write budget
+namespace ServoWriteSchedulerTest {
+
+  void testLargestErrorWrittenFirst() {
+    Log::println("\n=== Largest Error Written First ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    Servo s0(board, frame, 0), s1(board, frame, 1), s2(board, frame, 2);
+    Joint j0(s0, states, JointMotion::degrees(90)), j1(s1, states, JointMotion::degrees(90)), j2(s2, states, JointMotion::degrees(90));
+    s0.begin(); s1.begin(); s2.begin();
+
+    ServoWriteScheduler scheduler(1);
+    scheduler.add(j0);
+    scheduler.add(j1);
+    scheduler.add(j2);
+
+    // All three moving, j1 furthest from what its servo shows
+    j0.setTargetDegrees(180.0f, 90.0f);
+    j1.setTargetDegrees(180.0f, 600.0f);
+    j2.setTargetDegrees(180.0f, 180.0f);
+    states.update(100);
+
+    SHOULD(scheduler.schedule() == 1);
+    SHOULD(frame.get(1) == s1.angleToPWM(j1.getPosition()));
+    SHOULD(frame.get(0) == s0.angleToPWM(JointMotion::degrees(90)));  // Deferred
+    SHOULD(scheduler.getDeferredCount() == 2);
+
+    // Next frame: j2 is now furthest behind
+    SHOULD(scheduler.schedule() == 1);
+    SHOULD(frame.get(2) == s2.angleToPWM(j2.getPosition()));
+  }
+
+  void testFinalPositionAlwaysWritten() {
+    Log::println("\n=== Final Position Always Written ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    Servo s0(board, frame, 0), s1(board, frame, 1);
+    Joint j0(s0, states, JointMotion::degrees(90)), j1(s1, states, JointMotion::degrees(90));
+    s0.begin(); s1.begin();
+    s0.setHysteresis(20);
+
+    ServoWriteScheduler scheduler(1);
+    scheduler.add(j0);
+    scheduler.add(j1);
+
+    // j0 lands inside the hysteresis band, j1 is still moving
+    j0.setTargetDegrees(93.0f, 90.0f);
+    j1.setTargetDegrees(180.0f, 90.0f);
+    states.update(100);
+    SHOULD(j0.atTarget());
+
+    // Budget of one is used by the final write, but it is never skipped
+    scheduler.schedule();
+    SHOULD(frame.get(0) == s0.angleToPWM(JointMotion::degrees(93)));
+    SHOULD(scheduler.getFinalWriteCount() == 1);
+    SHOULD(scheduler.getDeferredCount() == 1);
+
+    // Nothing more to do for j0 - j1 gets the budget next frame
+    scheduler.schedule();
+    SHOULD(scheduler.getFinalWriteCount() == 1);
+    SHOULD(frame.get(1) == s1.angleToPWM(j1.getPosition()));
+  }
+
+  void testReleasedServoNotWritten() {
+    Log::println("\n=== Released Servo Not Written ===");
+
+    Board board;
+    ServoFrame frame;
+    JointStates states;
+    Servo s0(board, frame, 0);
+    Joint j0(s0, states, JointMotion::degrees(90));
+    s0.begin();
+    s0.release();
+
+    ServoWriteScheduler scheduler;
+    scheduler.add(j0);
+
+    SHOULD(scheduler.schedule() == 0);
+    SHOULD(s0.isReleased());
+  }
+
+  void runAll() {
+    Log::println("\n\n========================================");
+    Log::println("       SERVO WRITE SCHEDULER TEST SUITE");
+    Log::println("========================================");
+
+    testLargestErrorWrittenFirst();
+    testFinalPositionAlwaysWritten();
+    testReleasedServoNotWritten();
+
+    Log::println("\n========================================");
+    Log::println("       TESTS COMPLETE");
+    Log::println("========================================\n");
+  }
+
+} // namespace ServoWriteSchedulerTest
+
+#endif
@@ -1,5 +1,23 @@
 #include <logging.h>
 #include "joint_test.h"
+#include "servo_frame_test.h"
+#include "servo_calibration_test.h"
+#include "servo_output_task_test.h"
+#include "bus_benchmark_test.h"
+#include "idle_release_test.h"
+#include "servo_write_scheduler_test.h"
+#include "control_frame_clock_test.h"
+#include "joint_motion_test.h"
+#include "motion_complete_test.h"
+#include "motion_profile_test.h"
+#include "multi_step_gait_test.h"
+#include "phase_gait_test.h"
+#include "gait_transition_test.h"
+#include "gait_compiler_test.h"
+#include "gait_generator_test.h"
+#include "leg_kinematics_test.h"
+#include "gait_arena_test.h"
+#include "gait_library_test.h"
 
 void setup(){
   Log::begin();
@@ -8,6 +26,60 @@ void setup(){
   // Run Joint class tests
   JointTest::runAll();
 
+  // Run frame-based servo output tests
+  ServoFrameTest::runAll();
+
+  // Run calibrated angle table tests
+  ServoCalibrationTest::runAll();
+
+  // Run background servo output task tests
+  ServoOutputTaskTest::runAll();
+
+  // Run I2C clock benchmark tests
+  BusBenchmarkTest::runAll();
+
+  // Run idle de-energize tests
+  IdleReleaseTest::runAll();
+
+  // Run servo write budget tests
+  ServoWriteSchedulerTest::runAll();
+
+  // Run fixed-rate control frame tests
+  ControlFrameClockTest::runAll();
+
+  // Run fixed-point joint motion tests
+  JointMotionTest::runAll();
+
+  // Run motion complete event tests
+  MotionCompleteTest::runAll();
+
+  // Run trapezoid and S-curve profile tests
+  MotionProfileTest::runAll();
+
+  // Run multi-step gait sequencing tests
+  MultiStepGaitTest::runAll();
+
+  // Run per-leg phase gait tests
+  PhaseGaitTest::runAll();
+
+  // Run gait-to-gait transition tests
+  GaitTransitionTest::runAll();
+
+  // Run compile-time gait table tests
+  GaitCompilerTest::runAll();
+
+  // Run parametric gait generator tests
+  GaitGeneratorTest::runAll();
+
+  // Run foot-space kinematics tests
+  LegKinematicsTest::runAll();
+
+  // Run binary gait upload tests
+  GaitArenaTest::runAll();
+
+  // Run flash gait library tests
+  GaitLibraryTest::runAll();
+
   Log::println("\nAll test suites complete!");
 }
 